@@ -124,6 +124,9 @@ MxS32 g_targetDepth = 16;
 // GLOBAL: ISLE 0x410064
 MxS32 g_reqEnableRMDevice = FALSE;
 
+// Milliseconds to sleep per iteration while the game is paused in the background
+#define IDLE_DELAY 20
+
 MxFloat g_lastJoystickMouseX = 0;
 MxFloat g_lastJoystickMouseY = 0;
 MxFloat g_lastMouseX = 320;
@@ -223,11 +226,29 @@ IsleApp::IsleApp()
 	m_msaaSamples = 0;
 	m_anisotropic = 16.0f;
 	m_activeInBackground = FALSE;
+	m_lowLatencyAudio = FALSE;
+	m_lastFrameTicks = 0;
+	m_lastFrameInterval = 0;
+	m_frameIntervalTotal = 0;
+	m_frameJitterTotal = 0;
+	m_frameJitterPeak = 0;
+	m_frameCount = 0;
 }
 
 // FUNCTION: ISLE 0x4011a0
 IsleApp::~IsleApp()
 {
+	if (m_frameCount > 1) {
+		SDL_LogDebug(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"Frame pacing: %u frames, %.2f ms average interval, %.2f ms average and %.2f ms peak jitter",
+			m_frameCount,
+			GetFrameIntervalAverage() / 1000000.0,
+			GetFrameJitterAverage() / 1000000.0,
+			m_frameJitterPeak / 1000000.0
+		);
+	}
+
 	if (LegoOmni::GetInstance()) {
 		Close();
 		MxOmni::DestroyInstance();
@@ -988,6 +1009,7 @@ MxResult IsleApp::SetupWindow()
 	);
 
 	MxOmni::SetSound3D(m_use3dSound);
+	MxOmni::SetLowLatencyAudio(m_lowLatencyAudio);
 
 	srand(time(NULL));
 
@@ -1209,6 +1231,7 @@ bool IsleApp::LoadConfig()
 
 		iniparser_set(dict, "isle:3DSound", m_use3dSound ? "true" : "false");
 		iniparser_set(dict, "isle:Music", m_useMusic ? "true" : "false");
+		iniparser_set(dict, "isle:Low Latency Audio", m_lowLatencyAudio ? "true" : "false");
 
 		SDL_snprintf(buf, sizeof(buf), "%f", m_cursorSensitivity);
 		iniparser_set(dict, "isle:Cursor Sensitivity", buf);
@@ -1279,6 +1302,7 @@ bool IsleApp::LoadConfig()
 	m_wideViewAngle = iniparser_getboolean(dict, "isle:Wide View Angle", m_wideViewAngle);
 	m_use3dSound = iniparser_getboolean(dict, "isle:3DSound", m_use3dSound);
 	m_useMusic = iniparser_getboolean(dict, "isle:Music", m_useMusic);
+	m_lowLatencyAudio = iniparser_getboolean(dict, "isle:Low Latency Audio", m_lowLatencyAudio);
 	m_cursorSensitivity = iniparser_getdouble(dict, "isle:Cursor Sensitivity", m_cursorSensitivity);
 
 	MxS32 backBuffersInVRAM = iniparser_getboolean(dict, "isle:Back Buffers in Video RAM", -1);
@@ -1362,7 +1386,9 @@ inline bool IsleApp::Tick()
 	static MxS32 g_startupDelay = 1;
 
 	if (!m_windowActive) {
-		SDL_Delay(1);
+		// Nothing is ticked in the background, so there is no need to poll for focus at a frame's rate
+		m_lastFrameTicks = 0;
+		SDL_Delay(IDLE_DELAY);
 		return true;
 	}
 
@@ -1390,12 +1416,21 @@ inline bool IsleApp::Tick()
 	}
 
 	if (m_frameDelta + g_lastFrameTime >= currentTime) {
-		SDL_Delay(1);
+		// Sleep until the frame is due instead of waking up every millisecond. SDL_DelayPrecise spins
+		// through the last stretch so the frame does not slip by a scheduler tick. Returning lets the
+		// events that arrived in the meantime be queued before the frame is ticked.
+		SDL_DelayPrecise(SDL_MS_TO_NS(m_frameDelta + g_lastFrameTime - currentTime + 1));
 		return true;
 	}
 
+	TrackFrameInterval();
+
 	if (!Lego()->IsPaused()) {
 		TickleManager()->Tickle();
+
+		if (InputManager()) {
+			InputManager()->FrameCompleted();
+		}
 	}
 	g_lastFrameTime = currentTime;
 
@@ -1444,6 +1479,28 @@ inline bool IsleApp::Tick()
 	return true;
 }
 
+void IsleApp::TrackFrameInterval()
+{
+	Uint64 ticks = SDL_GetTicksNS();
+
+	if (m_lastFrameTicks) {
+		Uint64 interval = ticks - m_lastFrameTicks;
+
+		if (m_frameCount) {
+			Uint64 jitter =
+				interval > m_lastFrameInterval ? interval - m_lastFrameInterval : m_lastFrameInterval - interval;
+			m_frameJitterTotal += jitter;
+			m_frameJitterPeak = SDL_max(m_frameJitterPeak, jitter);
+		}
+
+		m_frameIntervalTotal += interval;
+		m_lastFrameInterval = interval;
+		m_frameCount++;
+	}
+
+	m_lastFrameTicks = ticks;
+}
+
 // FUNCTION: ISLE 0x402e80
 void IsleApp::SetupCursor(Cursor p_cursor)
 {
@@ -58,6 +58,11 @@ class IsleApp {
 	MxBool GetHaptic() { return m_haptic; }
 	MxBool GetActiveInBackground() { return m_activeInBackground; }
 
+	// Frame pacing statistics in nanoseconds. Jitter is the change in interval between consecutive frames.
+	Uint64 GetFrameIntervalAverage() const { return m_frameCount ? m_frameIntervalTotal / m_frameCount : 0; }
+	Uint64 GetFrameJitterAverage() const { return m_frameCount > 1 ? m_frameJitterTotal / (m_frameCount - 1) : 0; }
+	Uint64 GetFrameJitterPeak() const { return m_frameJitterPeak; }
+
 	void SetWindowActive(MxS32 p_windowActive) { m_windowActive = p_windowActive; }
 	void SetGameStarted(MxS32 p_gameStarted) { m_gameStarted = p_gameStarted; }
 	void SetDrawCursor(MxS32 p_drawCursor) { m_drawCursor = p_drawCursor; }
@@ -101,6 +106,7 @@ class IsleApp {
 	char* m_mediaPath;
 	MxFloat m_cursorSensitivity;
 	void DisplayArgumentHelp(const char* p_execName);
+	void TrackFrameInterval();
 
 	const char* m_iniPath;
 	MxFloat m_maxLod;
@@ -119,6 +125,13 @@ class IsleApp {
 	MxU32 m_msaaSamples;
 	MxFloat m_anisotropic;
 	MxBool m_activeInBackground;
+	MxBool m_lowLatencyAudio;
+	Uint64 m_lastFrameTicks;
+	Uint64 m_lastFrameInterval;
+	Uint64 m_frameIntervalTotal;
+	Uint64 m_frameJitterTotal;
+	Uint64 m_frameJitterPeak;
+	MxU32 m_frameCount;
 };
 
 extern IsleApp* g_isle;
@@ -63,12 +63,27 @@ class LegoCacheSoundManager {
 	LegoCacheSound* ManageSoundEntry(LegoCacheSound* p_sound);
 	LegoCacheSound* Play(const char* p_key, const char* p_name, MxBool p_looping);
 	LegoCacheSound* Play(LegoCacheSound* p_sound, const char* p_name, MxBool p_looping);
+
+	// Plays a sound without handing out the clone that plays it. Unlike the clones returned by Play,
+	// which their caller may still stop after they finish, these are kept and replayed.
+	void PlayOneShot(const char* p_key, const char* p_name);
+	void PlayOneShot(LegoCacheSound* p_sound, const char* p_name);
+
 	void Stop(LegoCacheSound*& p_sound);
 	void Destroy(LegoCacheSound*& p_sound);
 
 private:
+	LegoCacheSound* PlayVoice(LegoCacheSound* p_sound, const char* p_name, MxBool p_looping, MxBool p_oneShot);
+	LegoCacheSound* AcquireVoice(LegoCacheSound* p_sound);
+	void RecycleVoice(LegoCacheSound* p_voice);
+	void StealVoice();
+
 	Set100d6b4c m_set;   // 0x04
 	List100d6b4c m_list; // 0x14
+
+	// Finished one-shot clones kept around to be replayed, so repeated one-shots (clicks, crashes,
+	// footsteps) do not create a new sound and copy of their data every time
+	List100d6b4c m_idle;
 };
 
 // SYNTHETIC: BETA10 0x100d06b0
@@ -43,6 +43,8 @@ class LegoCacheSound : public MxCore {
 
 	const MxString& GetUnknown0x48() const { return m_unk0x48; }
 	const MxBool GetUnknown0x58() const { return m_unk0x58; }
+	MxBool IsOneShot() const { return m_oneShot; }
+	void SetOneShot(MxBool p_oneShot) { m_oneShot = p_oneShot; }
 
 	LegoCacheSound* Clone();
 	MxResult Play(const char* p_name, MxBool p_looping);
@@ -51,6 +53,7 @@ class LegoCacheSound : public MxCore {
 	void SetDistance(MxS32 p_min, MxS32 p_max);
 	void MuteSilence(MxBool p_muted);
 	void MuteStop(MxBool p_mute);
+	void ResetVoice();
 	LegoCacheSound& operator=(LegoCacheSound& p_sound);
 	void CopyFrom(LegoCacheSound& p_sound);
 
@@ -84,6 +87,9 @@ class LegoCacheSound : public MxCore {
 	MxBool m_unk0x70;                  // 0x70
 	MxString m_unk0x74;                // 0x74
 	MxBool m_muted;                    // 0x84
+
+	// Played without handing the clone to a caller, so it can be replayed once it finishes
+	MxBool m_oneShot;
 };
 
 #endif // LEGOCACHSOUND_H
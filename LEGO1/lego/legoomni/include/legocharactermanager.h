@@ -14,6 +14,7 @@ class LegoActor;
 class LegoExtraActor;
 class LegoStorage;
 class LegoROI;
+class ViewLODList;
 
 #pragma warning(disable : 4237)
 
@@ -48,6 +49,9 @@ struct LegoActorInfo;
 
 typedef map<char*, LegoCharacter*, LegoCharacterComparator> LegoCharacterMap;
 
+// Prepared actor part LOD lists, keyed by part LOD name and appearance
+typedef map<char*, ViewLODList*, LegoCharacterComparator> LegoPartTemplateMap;
+
 // VTABLE: LEGO1 0x100da878
 // VTABLE: BETA10 0x101bc028
 // SIZE 0x24
@@ -58,7 +62,7 @@ class CustomizeAnimFileVariable : public MxVariable {
 	void SetValue(const char* p_value) override; // vtable+0x04
 };
 
-// SIZE 0x08
+// SIZE 0x0c
 class LegoCharacterManager {
 public:
 	LegoCharacterManager();
@@ -95,6 +99,7 @@ class LegoCharacterManager {
 	LegoROI* CreateAutoROI(const char* p_name, const char* p_lodName, MxBool p_createEntity);
 	MxResult UpdateBoundingSphereAndBox(LegoROI* p_roi);
 	LegoROI* FUN_10085a80(const char* p_name, const char* p_lodName, MxBool p_createEntity);
+	void UnsharePartLODs(LegoROI* p_roi);
 
 	static const char* GetCustomizeAnimFile() { return g_customizeAnimFile; }
 
@@ -102,6 +107,8 @@ class LegoCharacterManager {
 	friend class Extensions::Common::CharacterCloner;
 
 	LegoROI* CreateActorROI(const char* p_key);
+	LegoROI* InstanceActorROI(const char* p_name, LegoActorInfo* p_info);
+	ViewLODList* GetPartTemplate(const char* p_lodName, char p_appearanceType, const char* p_appearance);
 	void RemoveROI(LegoROI* p_roi);
 	LegoROI* FindChildROI(LegoROI* p_roi, const char* p_name);
 
@@ -111,6 +118,7 @@ class LegoCharacterManager {
 
 	LegoCharacterMap* m_characters;                 // 0x00
 	CustomizeAnimFileVariable* m_customizeAnimFile; // 0x04
+	LegoPartTemplateMap* m_partTemplates;           // 0x08
 };
 
 // clang-format off
@@ -30,6 +30,9 @@ class LegoFlcTexturePresenter : public MxFlcPresenter {
 	void LoadFrame(MxStreamChunk* p_chunk) override; // vtable+0x68
 	void PutFrame() override;                        // vtable+0x6c
 
+	// PutFrame() uploads m_frameBitmap based on the rect count LoadFrame() records
+	MxBool SupportsBackgroundDecode() override { return FALSE; }
+
 	// SYNTHETIC: LEGO1 0x1005df00
 	// LegoFlcTexturePresenter::`scalar deleting destructor'
 
@@ -169,6 +169,13 @@ class LegoInputManager : public MxPresenter {
 	LEGO1_EXPORT void UpdateLastInputMethod(SDL_Event* p_event);
 	const auto& GetLastInputMethod() { return m_lastInputMethod; }
 
+	// Arrival time (SDL_GetTicksNS) of the latest event that may have changed the navigation input,
+	// so motion can be integrated from that moment rather than from the start of the frame
+	Uint64 GetNavigationInputTime() const { return m_navigationInputTime; }
+
+	// Called once a frame has been rendered, to measure how long input waited to be shown
+	LEGO1_EXPORT void FrameCompleted();
+
 	// clang-format off
 	enum class SDL_KeyboardID_v : SDL_KeyboardID {};
 	enum class SDL_MouseID_v : SDL_MouseID {};
@@ -184,6 +191,7 @@ class LegoInputManager : public MxPresenter {
 	friend class Extensions::ThirdPersonCameraExt;
 
 	void InitializeHaptics();
+	void TrackInputTime(SDL_Event* p_event);
 
 	MxCriticalSection m_criticalSection;  // 0x58
 	LegoNotifyList* m_keyboardNotifyList; // 0x5c
@@ -215,6 +223,12 @@ class LegoInputManager : public MxPresenter {
 	std::map<SDL_JoystickID, std::pair<SDL_Gamepad*, SDL_Haptic*>> m_joysticks;
 	std::map<SDL_HapticID, SDL_Haptic*> m_otherHaptics;
 	std::variant<SDL_KeyboardID_v, SDL_MouseID_v, SDL_JoystickID_v, SDL_TouchID_v> m_lastInputMethod;
+
+	Uint64 m_navigationInputTime = 0;
+	Uint64 m_pendingInputTime = 0; // Arrival of the oldest input not yet shown by a frame, 0 if none
+	Uint64 m_inputLatencyTotal = 0;
+	Uint64 m_inputLatencyPeak = 0;
+	MxU32 m_inputLatencyFrames = 0;
 };
 
 // TEMPLATE: LEGO1 0x10028850
@@ -6,13 +6,14 @@
 #include "mxvideopresenter.h"
 
 class LegoROI;
+class LegoTextureLoadJob;
 class LegoWorld;
 class LegoEntity;
 class MxDSChunk;
 
 // VTABLE: LEGO1 0x100d4e50
 // VTABLE: BETA10 0x101bcd88
-// SIZE 0x6c
+// SIZE 0x70
 class LegoModelPresenter : public MxVideoPresenter {
 public:
 	LegoModelPresenter() { Reset(); }
@@ -47,6 +48,7 @@ class LegoModelPresenter : public MxVideoPresenter {
 
 	void ReadyTickle() override; // vtable+0x18
 	void ParseExtra() override;  // vtable+0x30
+	void EndAction() override;   // vtable+0x40
 
 	MxResult CreateROI(MxDSChunk& p_chunk, LegoEntity* p_entity, MxBool p_roiVisible, LegoWorld* p_world);
 
@@ -54,6 +56,7 @@ class LegoModelPresenter : public MxVideoPresenter {
 	{
 		m_roi = NULL;
 		m_addedToView = FALSE;
+		m_textureLoadJob = NULL;
 	}
 
 	// SYNTHETIC: LEGO1 0x1000cdd0
@@ -61,14 +64,16 @@ class LegoModelPresenter : public MxVideoPresenter {
 
 protected:
 	void Destroy(MxBool p_fromDestructor);
+	void CancelTextureLoad();
 
 private:
 	friend class Multiplayer::Animation::Catalog;
 
-	LegoROI* m_roi;       // 0x64
-	MxBool m_addedToView; // 0x68
+	LegoROI* m_roi;                       // 0x64
+	MxBool m_addedToView;                 // 0x68
+	LegoTextureLoadJob* m_textureLoadJob; // 0x6c
 
-	MxResult CreateROI(MxDSChunk* p_chunk);
+	MxResult CreateROI(MxDSChunk* p_chunk, LegoTextureLoadJob* p_textures = NULL);
 };
 
 #endif // LEGOMODELPRESENTER_H
@@ -6,8 +6,10 @@
 #include "mxmediapresenter.h"
 #include "viewmanager/viewlodlist.h"
 
+class LegoTextureLoadJob;
+
 // VTABLE: LEGO1 0x100d4df0
-// SIZE 0x54
+// SIZE 0x58
 class LegoPartPresenter : public MxMediaPresenter {
 public:
 	LegoPartPresenter() { Reset(); }
@@ -40,15 +42,20 @@ class LegoPartPresenter : public MxMediaPresenter {
 
 	void ReadyTickle() override;      // vtable+0x18
 	MxResult AddToManager() override; // vtable+0x34
+	void EndAction() override;        // vtable+0x40
 
 	LEGO1_EXPORT static void configureLegoPartPresenter(MxS32, MxS32);
 
 	// SYNTHETIC: LEGO1 0x1000d060
 	// LegoPartPresenter::`scalar deleting destructor'
 
-	void Reset() { m_parts = NULL; }
+	void Reset()
+	{
+		m_parts = NULL;
+		m_textureLoadJob = NULL;
+	}
 
-	MxResult Read(MxDSChunk& p_chunk);
+	MxResult Read(MxDSChunk& p_chunk, LegoTextureLoadJob* p_textures = NULL);
 	void Store();
 
 	static void Release()
@@ -62,8 +69,10 @@ class LegoPartPresenter : public MxMediaPresenter {
 
 private:
 	void Destroy(MxBool p_fromDestructor);
+	void CancelTextureLoad();
 
-	LegoNamedPartList* m_parts; // 0x50
+	LegoNamedPartList* m_parts;           // 0x50
+	LegoTextureLoadJob* m_textureLoadJob; // 0x54
 
 	static vector<ViewLODList*> g_lodLists;
 };
@@ -8,6 +8,8 @@
 #include "legopathstruct.h"
 #include "mxstl/stlcompat.h"
 
+#include <vector>
+
 class LegoAnimPresenter;
 class LegoWorld;
 class MxAtomId;
@@ -203,6 +205,9 @@ class LegoPathController : public MxCore {
 	LegoPathCtrlEdgeSet m_pfsE;     // 0x20
 	LegoPathActorSet m_actors;      // 0x30
 
+	// Per-frame snapshot of m_actors for AnimateActors, kept to avoid rebuilding a tree every frame
+	std::vector<LegoPathActor*> m_animateActors;
+
 	// Names verified by BETA10
 	static CtrlBoundary* g_ctrlBoundariesA;
 	static CtrlEdge* g_ctrlEdgesA;
@@ -34,6 +34,9 @@ class LegoPhonemePresenter : public MxFlcPresenter {
 	void LoadFrame(MxStreamChunk* p_chunk) override; // vtable+0x68
 	void PutFrame() override;                        // vtable+0x6c
 
+	// LoadFrame() also updates the shared phoneme texture
+	MxBool SupportsBackgroundDecode() override { return FALSE; }
+
 	// SYNTHETIC: LEGO1 0x1004e320
 	// LegoPhonemePresenter::`scalar deleting destructor'
 
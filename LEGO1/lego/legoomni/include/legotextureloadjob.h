@@ -0,0 +1,43 @@
+#ifndef LEGOTEXTURELOADJOB_H
+#define LEGOTEXTURELOADJOB_H
+
+#include "misc/legotypes.h"
+#include "mxjobpool.h"
+
+#include <vector>
+
+class LegoTexture;
+
+// Decodes the texture table of a model or part chunk. Reading the images and squaring them up for the device
+// can run on a job worker; Store() then creates the texture infos, which need the device, on the tickle thread.
+// The chunk data must stay alive until the job is done.
+class LegoTextureLoadJob : public MxJob {
+public:
+	enum Format {
+		e_part,  // Table offset at 0, no skip flag
+		e_model, // Version at 0, table offset at 4, skip flag after the texture count
+	};
+
+	LegoTextureLoadJob(void* p_data, LegoU32 p_length, Format p_format, MxS32 p_firstVariant, LegoS32 p_hardwareMode);
+	~LegoTextureLoadJob() override;
+
+	void Run() override;
+	MxResult Store();
+
+private:
+	struct Texture {
+		LegoChar* m_name;
+		LegoTexture* m_texture;
+	};
+
+	void* m_data;
+	LegoU32 m_length;
+	Format m_format;
+	MxS32 m_firstVariant; // For textures with two variants, whether to keep the first one
+	LegoS32 m_hardwareMode;
+	MxResult m_result;
+	LegoU32 m_skipTextures;
+	std::vector<Texture> m_textures;
+};
+
+#endif // LEGOTEXTURELOADJOB_H
@@ -47,6 +47,8 @@ class LegoWorldPresenter : public LegoEntityPresenter {
 
 	MxResult LoadWorld(char* p_worldName, LegoWorld* p_world);
 
+	static void ReleaseModelDb();
+
 	// SYNTHETIC: LEGO1 0x10066750
 	// LegoWorldPresenter::`scalar deleting destructor'
 
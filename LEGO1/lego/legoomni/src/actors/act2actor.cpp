@@ -174,7 +174,7 @@ MxResult Act2Actor::HitActor(LegoPathActor*, MxBool)
 		m_animationDuration = 0;
 	}
 
-	SoundManager()->GetCacheSoundManager()->Play("hitactor", NULL, FALSE);
+	SoundManager()->GetCacheSoundManager()->PlayOneShot("hitactor", NULL);
 	return SUCCESS;
 }
 
@@ -587,7 +587,7 @@ MxU32 Act2Actor::UpdateShot(MxFloat p_time)
 	if (!g_playedShootSound && m_entityAnimationTime < p_time) {
 		g_playedShootSound = TRUE;
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play(m_cachedShootSound, "brickstr", FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot(m_cachedShootSound, "brickstr");
 
 		if (g_nextEntityIsBuilding) {
 			BuildingManager()->ScheduleAnimation(m_nextEntity, 800, TRUE, FALSE);
@@ -200,7 +200,7 @@ MxResult Act3Cop::HitActor(LegoPathActor* p_actor, MxBool p_bool)
 		SetWorldSpeed(6.0);
 
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play("eatdn", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("eatdn", NULL);
 		FUN_10040360();
 	}
 	else {
@@ -387,7 +387,7 @@ MxResult Act3Cop::FUN_10040360()
 					a3->EatDonut(i);
 					m_unk0x20 = m_transformTime + 2000;
 					SetWorldSpeed(6.0);
-					SoundManager()->GetCacheSoundManager()->Play("eatdn", NULL, FALSE);
+					SoundManager()->GetCacheSoundManager()->PlayOneShot("eatdn", NULL);
 					continue;
 				}
 
@@ -612,7 +612,7 @@ void Act3Brickster::Animate(float p_time)
 			((Act3*) m_world)->TriggerHitSound(6);
 		}
 		else {
-			SoundManager()->GetCacheSoundManager()->Play("eatpz", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("eatpz", NULL);
 		}
 
 		FUN_100417c0();
@@ -626,7 +626,7 @@ void Act3Brickster::Animate(float p_time)
 			}
 
 			assert(SoundManager()->GetCacheSoundManager());
-			SoundManager()->GetCacheSoundManager()->Play("thpt", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("thpt", NULL);
 			m_unk0x58 = 0;
 			FUN_100417c0();
 		}
@@ -665,7 +665,7 @@ void Act3Brickster::Animate(float p_time)
 			((Act3*) m_world)->DisableHelicopterDot();
 			m_unk0x58 = 0;
 			assert(SoundManager()->GetCacheSoundManager());
-			SoundManager()->GetCacheSoundManager()->Play("thpt", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("thpt", NULL);
 
 			while (m_bInfo->m_counter > 0 || m_bInfo->m_counter == -1) {
 				if (!BuildingManager()->DecrementCounter(m_bInfo)) {
@@ -711,7 +711,7 @@ void Act3Brickster::Animate(float p_time)
 			m_unk0x38 = 3;
 			m_unk0x50 = p_time + m_shootAnim->GetDuration();
 			assert(SoundManager()->GetCacheSoundManager());
-			SoundManager()->GetCacheSoundManager()->Play("xarrow", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("xarrow", NULL);
 		}
 		else {
 			FUN_10042300();
@@ -723,7 +723,7 @@ void Act3Brickster::Animate(float p_time)
 			m_unk0x38 = 4;
 			m_unk0x50 = p_time + m_shootAnim->GetDuration();
 			assert(SoundManager()->GetCacheSoundManager());
-			SoundManager()->GetCacheSoundManager()->Play("xarrow", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("xarrow", NULL);
 			BuildingManager()->ScheduleAnimation(m_bInfo->m_entity, 0, FALSE, TRUE);
 			m_unk0x3c = m_bInfo->m_entity->GetROI()->GetLocal2World()[3];
 		}
@@ -835,7 +835,7 @@ MxResult Act3Brickster::FUN_100417c0()
 					m_unk0x58++;
 					m_unk0x20 = m_transformTime + 2000.0f;
 					SetWorldSpeed(3.0f);
-					SoundManager()->GetCacheSoundManager()->Play("eatpz", NULL, FALSE);
+					SoundManager()->GetCacheSoundManager()->PlayOneShot("eatpz", NULL);
 					continue;
 				}
 
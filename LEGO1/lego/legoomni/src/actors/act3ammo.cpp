@@ -155,11 +155,11 @@ MxResult Act3Ammo::Shoot(LegoPathController* p_p, LegoPathBoundary* p_boundary,
 
 	if (IsPizza()) {
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play("shootpz", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("shootpz", NULL);
 	}
 	else {
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play("shootdn", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("shootdn", NULL);
 	}
 
 	m_pathController = p_p;
@@ -183,11 +183,11 @@ MxResult Act3Ammo::Shoot(LegoPathController* p_p, MxFloat p_apexParameter)
 
 	if (IsPizza()) {
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play("shootpz", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("shootpz", NULL);
 	}
 	else {
 		assert(SoundManager()->GetCacheSoundManager());
-		SoundManager()->GetCacheSoundManager()->Play("shootdn", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("shootdn", NULL);
 	}
 
 	m_pathController = p_p;
@@ -391,11 +391,11 @@ void Act3Ammo::Animate(float p_time)
 		else {
 			if (IsPizza()) {
 				assert(SoundManager()->GetCacheSoundManager());
-				SoundManager()->GetCacheSoundManager()->Play("stickpz", NULL, FALSE);
+				SoundManager()->GetCacheSoundManager()->PlayOneShot("stickpz", NULL);
 			}
 			else {
 				assert(SoundManager()->GetCacheSoundManager());
-				SoundManager()->GetCacheSoundManager()->Play("stickdn", NULL, FALSE);
+				SoundManager()->GetCacheSoundManager()->PlayOneShot("stickdn", NULL);
 			}
 		}
 
@@ -443,7 +443,7 @@ void Act3Ammo::Animate(float p_time)
 
 					if (IsDonut()) {
 						assert(SoundManager()->GetCacheSoundManager());
-						SoundManager()->GetCacheSoundManager()->Play("dnhitpz", NULL, FALSE);
+						SoundManager()->GetCacheSoundManager()->PlayOneShot("dnhitpz", NULL);
 						m_world->RemoveDonut(*this);
 						annihilated = TRUE;
 						break;
@@ -472,7 +472,7 @@ void Act3Ammo::Animate(float p_time)
 
 					if (IsPizza()) {
 						assert(SoundManager()->GetCacheSoundManager());
-						SoundManager()->GetCacheSoundManager()->Play("pzhitdn", NULL, FALSE);
+						SoundManager()->GetCacheSoundManager()->PlayOneShot("pzhitdn", NULL);
 						m_world->RemovePizza(*this);
 						annihilated = TRUE;
 						break;
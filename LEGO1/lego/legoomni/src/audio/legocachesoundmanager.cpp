@@ -6,6 +6,12 @@
 DECOMP_SIZE_ASSERT(LegoCacheSoundEntry, 0x08)
 DECOMP_SIZE_ASSERT(LegoCacheSoundManager, 0x20)
 
+// Clones playing at once; past this the oldest one-shot is cut off to make room
+#define MAX_ACTIVE_VOICES 32
+
+// Finished clones kept for reuse
+#define MAX_IDLE_VOICES 16
+
 // FUNCTION: LEGO1 0x1003cf20
 // STUB: BETA10 0x100d0700
 LegoCacheSoundManager::~LegoCacheSoundManager()
@@ -26,6 +32,12 @@ LegoCacheSoundManager::~LegoCacheSoundManager()
 		sound->Stop();
 		delete sound;
 	}
+
+	while (!m_idle.empty()) {
+		sound = (*m_idle.begin()).GetSound();
+		m_idle.erase(m_idle.begin());
+		delete sound;
+	}
 }
 
 // FUNCTION: LEGO1 0x1003d050
@@ -55,7 +67,13 @@ MxResult LegoCacheSoundManager::Tickle()
 		else {
 			sound->Stop();
 			m_list.erase(listIter++);
-			delete sound;
+
+			if (sound->IsOneShot()) {
+				RecycleVoice(sound);
+			}
+			else {
+				delete sound;
+			}
 		}
 	}
 
@@ -115,16 +133,45 @@ LegoCacheSound* LegoCacheSoundManager::Play(const char* p_key, const char* p_nam
 // FUNCTION: LEGO1 0x1003db10
 // FUNCTION: BETA10 0x10065537
 LegoCacheSound* LegoCacheSoundManager::Play(LegoCacheSound* p_sound, const char* p_name, MxBool p_looping)
+{
+	return PlayVoice(p_sound, p_name, p_looping, FALSE);
+}
+
+void LegoCacheSoundManager::PlayOneShot(const char* p_key, const char* p_name)
+{
+	PlayVoice(FindSoundByKey(p_key), p_name, FALSE, TRUE);
+}
+
+void LegoCacheSoundManager::PlayOneShot(LegoCacheSound* p_sound, const char* p_name)
+{
+	PlayVoice(p_sound, p_name, FALSE, TRUE);
+}
+
+LegoCacheSound* LegoCacheSoundManager::PlayVoice(
+	LegoCacheSound* p_sound,
+	const char* p_name,
+	MxBool p_looping,
+	MxBool p_oneShot
+)
 {
 	if (!p_sound) {
 		return NULL;
 	}
 
 	if (p_sound->GetUnknown0x58()) {
+		LegoCacheSound* voice = AcquireVoice(p_sound);
+
+		if (voice) {
+			voice->SetOneShot(p_oneShot);
+			voice->Play(p_name, p_looping);
+			return voice;
+		}
+
 		LegoCacheSound* clone = p_sound->Clone();
 
 		if (clone) {
 			LegoCacheSound* sound = ManageSoundEntry(clone);
+			sound->SetOneShot(p_oneShot);
 			sound->Play(p_name, p_looping);
 			return sound;
 		}
@@ -183,6 +230,20 @@ void LegoCacheSoundManager::Destroy(LegoCacheSound*& p_sound)
 		if ((*setIter).GetSound() == p_sound) {
 			p_sound->Stop();
 
+			// The name may be reused by a different sound once this one is gone
+			List100d6b4c::iterator idleIter = m_idle.begin();
+			while (idleIter != m_idle.end()) {
+				LegoCacheSound* voice = (*idleIter).GetSound();
+
+				if (!SDL_strcasecmp(voice->GetUnknown0x48().GetData(), p_sound->GetUnknown0x48().GetData())) {
+					m_idle.erase(idleIter++);
+					delete voice;
+				}
+				else {
+					idleIter++;
+				}
+			}
+
 			delete p_sound;
 			m_set.erase(setIter);
 			return;
@@ -209,3 +270,51 @@ void LegoCacheSoundManager::Destroy(LegoCacheSound*& p_sound)
 		}
 	}
 }
+
+// Returns an idle clone of p_sound moved to the playing list, or NULL if there is none
+LegoCacheSound* LegoCacheSoundManager::AcquireVoice(LegoCacheSound* p_sound)
+{
+	if (m_list.size() >= MAX_ACTIVE_VOICES) {
+		StealVoice();
+	}
+
+	for (List100d6b4c::iterator it = m_idle.begin(); it != m_idle.end(); it++) {
+		LegoCacheSound* voice = (*it).GetSound();
+
+		if (!SDL_strcasecmp(voice->GetUnknown0x48().GetData(), p_sound->GetUnknown0x48().GetData())) {
+			m_idle.erase(it);
+			m_list.push_back(LegoCacheSoundEntry(voice));
+			voice->ResetVoice();
+			return voice;
+		}
+	}
+
+	return NULL;
+}
+
+void LegoCacheSoundManager::RecycleVoice(LegoCacheSound* p_voice)
+{
+	if (m_idle.size() >= MAX_IDLE_VOICES) {
+		LegoCacheSound* oldest = (*m_idle.begin()).GetSound();
+		m_idle.erase(m_idle.begin());
+		delete oldest;
+	}
+
+	m_idle.push_back(LegoCacheSoundEntry(p_voice));
+}
+
+// Cuts off the oldest playing one-shot. Clones returned by Play are never taken, their owner
+// may still stop or destroy them.
+void LegoCacheSoundManager::StealVoice()
+{
+	for (List100d6b4c::iterator it = m_list.begin(); it != m_list.end(); it++) {
+		LegoCacheSound* voice = (*it).GetSound();
+
+		if (voice->IsOneShot()) {
+			voice->Stop();
+			m_list.erase(it);
+			RecycleVoice(voice);
+			return;
+		}
+	}
+}
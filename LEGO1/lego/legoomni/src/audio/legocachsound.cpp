@@ -36,6 +36,7 @@ void LegoCacheSound::Init()
 	m_volume = 79;
 	m_unk0x70 = FALSE;
 	m_muted = FALSE;
+	m_oneShot = FALSE;
 }
 
 // FUNCTION: LEGO1 0x10006710
@@ -272,6 +273,16 @@ void LegoCacheSound::MuteStop(MxBool p_muted)
 	}
 }
 
+// Undoes what a previous play may have changed, so a finished clone can be replayed like a fresh one
+void LegoCacheSound::ResetVoice()
+{
+	m_muted = FALSE;
+
+	MxS32 volume = m_volume * SoundManager()->GetVolume() / 100;
+	ma_sound_set_volume(m_cacheSound, SoundManager()->GetAttenuation(volume));
+	ma_sound_set_pitch(m_cacheSound, 1.0f);
+}
+
 // FUNCTION: BETA10 0x10066fa9
 LegoCacheSound::LegoCacheSound(LegoCacheSound& p_sound)
 {
@@ -41,6 +41,16 @@ DECOMP_SIZE_ASSERT(AnimState, 0x1c)
 DECOMP_SIZE_ASSERT(AnimInfo, 0x30)
 DECOMP_SIZE_ASSERT(ModelInfo, 0x30)
 
+// Contents of the *inf.dta files, kept across world switches so returning to a world does not hit the disc again.
+// An entry is reloaded when the size or modification time of its file changes.
+struct WorldInfoFile {
+	MxU8* m_data;
+	size_t m_size;
+	SDL_Time m_modifyTime;
+};
+
+static WorldInfoFile g_worldInfoFiles[LegoOmni::e_numWorlds];
+
 // GLOBAL: LEGO1 0x100d8b28
 MxU8 g_unk0x100d8b28[] = {0, 1, 2, 4, 8, 16};
 
@@ -377,6 +387,11 @@ LegoAnimationManager::~LegoAnimationManager()
 		delete m_unk0x424;
 	}
 
+	for (MxS32 i = 0; i < (MxS32) sizeOfArray(g_worldInfoFiles); i++) {
+		SDL_free(g_worldInfoFiles[i].m_data);
+		g_worldInfoFiles[i].m_data = NULL;
+	}
+
 	NotificationManager()->Unregister(this);
 }
 
@@ -639,8 +654,6 @@ MxResult LegoAnimationManager::LoadWorldInfo(LegoOmni::World p_worldId)
 
 		DeleteAnimations();
 
-		LegoFile storage;
-
 		if (p_worldId == LegoOmni::e_undefined) {
 			result = SUCCESS;
 			goto done;
@@ -675,10 +688,20 @@ MxResult LegoAnimationManager::LoadWorldInfo(LegoOmni::World p_worldId)
 			}
 		}
 
-		if (storage.Open(path, LegoFile::c_read) == FAILURE) {
-			goto done;
+		WorldInfoFile& file = g_worldInfoFiles[p_worldId];
+
+		if (file.m_data == NULL || file.m_size != pathInfo.size || file.m_modifyTime != pathInfo.modify_time) {
+			SDL_free(file.m_data);
+			file.m_data = (MxU8*) SDL_LoadFile(path, &file.m_size);
+			file.m_modifyTime = pathInfo.modify_time;
+
+			if (file.m_data == NULL) {
+				goto done;
+			}
 		}
 
+		LegoMemory storage(file.m_data, (LegoU32) file.m_size);
+
 		MxU32 version;
 		if (storage.Read(&version, sizeof(MxU32)) == FAILURE) {
 			goto done;
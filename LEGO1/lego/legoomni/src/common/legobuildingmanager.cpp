@@ -733,7 +733,7 @@ MxResult LegoBuildingManager::Tickle()
 
 			if (!entry->m_muted) {
 				entry->m_muted = TRUE;
-				SoundManager()->GetCacheSoundManager()->Play(m_sound, entry->m_roi->GetName(), FALSE);
+				SoundManager()->GetCacheSoundManager()->PlayOneShot(m_sound, entry->m_roi->GetName());
 			}
 
 			MxMatrix local48;
@@ -27,7 +27,7 @@
 using namespace Extensions;
 
 DECOMP_SIZE_ASSERT(LegoCharacter, 0x08)
-DECOMP_SIZE_ASSERT(LegoCharacterManager, 0x08)
+DECOMP_SIZE_ASSERT(LegoCharacterManager, 0x0c)
 DECOMP_SIZE_ASSERT(CustomizeAnimFileVariable, 0x24)
 
 // GLOBAL: LEGO1 0x100fc4d0
@@ -57,6 +57,18 @@ MxU32 g_infohatVariantCounter = 2;
 // GLOBAL: LEGO1 0x100fc4f0
 MxU32 g_autoRoiCounter = 0;
 
+MxU32 g_partLODCounter = 0;
+
+// Bounds and local transform of each actor part, the same for every actor
+struct LegoActorPartLayout {
+	BoundingSphere m_boundingSphere;
+	BoundingBox m_boundingBox;
+	MxMatrix m_local;
+};
+
+LegoActorPartLayout g_actorPartLayouts[sizeOfArray(g_actorLODs)];
+MxBool g_actorPartLayoutsInitialized = FALSE;
+
 // GLOBAL: LEGO1 0x10104f20
 LegoActorInfo g_actorInfo[66];
 
@@ -65,6 +77,7 @@ LegoActorInfo g_actorInfo[66];
 LegoCharacterManager::LegoCharacterManager()
 {
 	m_characters = new LegoCharacterMap();
+	m_partTemplates = new LegoPartTemplateMap();
 	Init(); // DECOMP: inlined here in BETA10
 
 	m_customizeAnimFile = new CustomizeAnimFileVariable("CUSTOMIZE_ANIM_FILE");
@@ -88,6 +101,15 @@ LegoCharacterManager::~LegoCharacterManager()
 	}
 
 	delete m_characters;
+
+	LegoPartTemplateMap::iterator templateIt;
+
+	for (templateIt = m_partTemplates->begin(); templateIt != m_partTemplates->end(); templateIt++) {
+		(*templateIt).second->Release();
+		delete[] (*templateIt).first;
+	}
+
+	delete m_partTemplates;
 	delete[] g_customizeAnimFile;
 }
 
@@ -462,21 +484,56 @@ void LegoCharacterManager::RemoveROI(LegoROI* p_roi)
 	VideoManager()->Get3DManager()->Remove(*p_roi);
 }
 
+static void InitActorPartLayouts()
+{
+	MxMatrix mat;
+
+	for (MxS32 i = 0; i < sizeOfArray(g_actorLODs); i++) {
+		LegoActorPartLayout& layout = g_actorPartLayouts[i];
+
+		layout.m_boundingSphere.Center()[0] = g_actorLODs[i].m_boundingSphere[0];
+		layout.m_boundingSphere.Center()[1] = g_actorLODs[i].m_boundingSphere[1];
+		layout.m_boundingSphere.Center()[2] = g_actorLODs[i].m_boundingSphere[2];
+		layout.m_boundingSphere.Radius() = g_actorLODs[i].m_boundingSphere[3];
+
+		layout.m_boundingBox.Min()[0] = g_actorLODs[i].m_boundingBox[0];
+		layout.m_boundingBox.Min()[1] = g_actorLODs[i].m_boundingBox[1];
+		layout.m_boundingBox.Min()[2] = g_actorLODs[i].m_boundingBox[2];
+		layout.m_boundingBox.Max()[0] = g_actorLODs[i].m_boundingBox[3];
+		layout.m_boundingBox.Max()[1] = g_actorLODs[i].m_boundingBox[4];
+		layout.m_boundingBox.Max()[2] = g_actorLODs[i].m_boundingBox[5];
+
+		CalcLocalTransform(
+			Mx3DPointFloat(g_actorLODs[i].m_position),
+			Mx3DPointFloat(g_actorLODs[i].m_direction),
+			Mx3DPointFloat(g_actorLODs[i].m_up),
+			mat
+		);
+		layout.m_local = mat;
+	}
+
+	g_actorPartLayoutsInitialized = TRUE;
+}
+
+static ViewLODList* CloneLODList(ViewLODList* p_source, const char* p_name)
+{
+	Tgl::Renderer* renderer = VideoManager()->GetRenderer();
+	MxS32 lodSize = p_source->Size();
+	ViewLODList* dupLodList = GetViewLODListManager()->Create(p_name, lodSize);
+
+	for (MxS32 i = 0; i < lodSize; i++) {
+		LegoLOD* lod = (LegoLOD*) (*p_source)[i];
+		dupLodList->PushBack(lod->Clone(renderer));
+	}
+
+	return dupLodList;
+}
+
 // FUNCTION: LEGO1 0x10084030
 // FUNCTION: BETA10 0x10074e4f
 LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 {
-	MxBool success = FALSE;
 	LegoROI* roi = NULL;
-	BoundingSphere boundingSphere;
-	BoundingBox boundingBox;
-	MxMatrix mat;
-	CompoundObject* comp;
-	MxS32 i;
-
-	Tgl::Renderer* renderer = VideoManager()->GetRenderer();
-	ViewLODListManager* lodManager = GetViewLODListManager();
-	LegoTextureContainer* textureContainer = TextureContainer();
 	LegoActorInfo* info = GetActorInfo(p_key);
 
 	if (info == NULL) {
@@ -490,124 +547,191 @@ LegoROI* LegoCharacterManager::CreateActorROI(const char* p_key)
 		info->m_move = pepper->m_move;
 		info->m_mood = pepper->m_mood;
 
-		for (i = 0; i < sizeOfArray(info->m_parts); i++) {
+		for (MxS32 i = 0; i < sizeOfArray(info->m_parts); i++) {
 			info->m_parts[i] = pepper->m_parts[i];
 		}
 	}
 
+	roi = InstanceActorROI(p_key, info);
+
+	if (roi != NULL) {
+		info->m_roi = roi;
+	}
+
+done:
+	return roi;
+}
+
+// Builds an actor ROI tree for the parts and appearance described by p_info. The parts share their LOD lists
+// with every other actor showing the same part in the same appearance; only the ROIs themselves are new.
+LegoROI* LegoCharacterManager::InstanceActorROI(const char* p_name, LegoActorInfo* p_info)
+{
+	MxBool success = FALSE;
+	LegoROI* roi = NULL;
+	CompoundObject* comp;
+	MxS32 i;
+
+	Tgl::Renderer* renderer = VideoManager()->GetRenderer();
+
+	if (!g_actorPartLayoutsInitialized) {
+		InitActorPartLayouts();
+	}
+
 	roi = new LegoROI(renderer);
-	roi->SetName(p_key);
-
-	boundingSphere.Center()[0] = g_actorLODs[c_topLOD].m_boundingSphere[0];
-	boundingSphere.Center()[1] = g_actorLODs[c_topLOD].m_boundingSphere[1];
-	boundingSphere.Center()[2] = g_actorLODs[c_topLOD].m_boundingSphere[2];
-	boundingSphere.Radius() = g_actorLODs[c_topLOD].m_boundingSphere[3];
-	roi->SetBoundingSphere(boundingSphere);
-
-	boundingBox.Min()[0] = g_actorLODs[c_topLOD].m_boundingBox[0];
-	boundingBox.Min()[1] = g_actorLODs[c_topLOD].m_boundingBox[1];
-	boundingBox.Min()[2] = g_actorLODs[c_topLOD].m_boundingBox[2];
-	boundingBox.Max()[0] = g_actorLODs[c_topLOD].m_boundingBox[3];
-	boundingBox.Max()[1] = g_actorLODs[c_topLOD].m_boundingBox[4];
-	boundingBox.Max()[2] = g_actorLODs[c_topLOD].m_boundingBox[5];
-	roi->SetBoundingBox(boundingBox);
+	roi->SetName(p_name);
+	roi->SetBoundingSphere(g_actorPartLayouts[c_topLOD].m_boundingSphere);
+	roi->SetBoundingBox(g_actorPartLayouts[c_topLOD].m_boundingBox);
 
 	comp = new CompoundObject();
 	roi->SetComp(comp);
 
 	for (i = 0; i < sizeOfArray(g_actorLODs) - 1; i++) {
-		char lodName[256];
-		LegoActorInfo::Part& part = info->m_parts[i];
+		LegoActorInfo::Part& part = p_info->m_parts[i];
+		MxU8 partNameIndex = part.m_partNameIndices[part.m_partNameIndex];
+		const char* appearance = part.m_names[part.m_nameIndices[part.m_nameIndex]];
 
 		const char* parentName;
 		if (i == 0 || i == 1) {
-			parentName = part.m_partName[part.m_partNameIndices[part.m_partNameIndex]];
+			parentName = part.m_partName[partNameIndex];
 		}
 		else {
 			parentName = g_actorLODs[i + 1].m_parentName;
 		}
 
-		ViewLODList* lodList = lodManager->Lookup(parentName);
-		MxS32 lodSize = lodList->Size();
-		sprintf(lodName, "%s%d", p_key, i);
-		ViewLODList* dupLodList = lodManager->Create(lodName, lodSize);
-
-		for (MxS32 j = 0; j < lodSize; j++) {
-			LegoLOD* lod = (LegoLOD*) (*lodList)[j];
-			LegoLOD* clone = lod->Clone(renderer);
-			dupLodList->PushBack(clone);
+		char appearanceType;
+		if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useTexture && (i != 0 || partNameIndex != 0)) {
+			appearanceType = 't';
+		}
+		else if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useColor || (i == 0 && partNameIndex == 0)) {
+			appearanceType = 'c';
+		}
+		else {
+			appearanceType = 'n';
+			appearance = "";
 		}
 
-		lodList->Release();
-		lodList = dupLodList;
+		ViewLODList* lodList = GetPartTemplate(parentName, appearanceType, appearance);
+
+		if (lodList == NULL) {
+			goto done;
+		}
 
 		LegoROI* childROI = new LegoROI(renderer, lodList);
 		lodList->Release();
 
 		childROI->SetName(g_actorLODs[i + 1].m_name);
 		childROI->SetParentROI(roi);
+		childROI->SetBoundingSphere(g_actorPartLayouts[i + 1].m_boundingSphere);
+		childROI->SetBoundingBox(g_actorPartLayouts[i + 1].m_boundingBox);
+		childROI->WrappedSetLocal2WorldWithWorldDataUpdate(g_actorPartLayouts[i + 1].m_local);
 
-		BoundingSphere childBoundingSphere;
-		childBoundingSphere.Center()[0] = g_actorLODs[i + 1].m_boundingSphere[0];
-		childBoundingSphere.Center()[1] = g_actorLODs[i + 1].m_boundingSphere[1];
-		childBoundingSphere.Center()[2] = g_actorLODs[i + 1].m_boundingSphere[2];
-		childBoundingSphere.Radius() = g_actorLODs[i + 1].m_boundingSphere[3];
-		childROI->SetBoundingSphere(childBoundingSphere);
-
-		BoundingBox childBoundingBox;
-		childBoundingBox.Min()[0] = g_actorLODs[i + 1].m_boundingBox[0];
-		childBoundingBox.Min()[1] = g_actorLODs[i + 1].m_boundingBox[1];
-		childBoundingBox.Min()[2] = g_actorLODs[i + 1].m_boundingBox[2];
-		childBoundingBox.Max()[0] = g_actorLODs[i + 1].m_boundingBox[3];
-		childBoundingBox.Max()[1] = g_actorLODs[i + 1].m_boundingBox[4];
-		childBoundingBox.Max()[2] = g_actorLODs[i + 1].m_boundingBox[5];
-		childROI->SetBoundingBox(childBoundingBox);
+		comp->push_back(childROI);
+	}
 
-		CalcLocalTransform(
-			Mx3DPointFloat(g_actorLODs[i + 1].m_position),
-			Mx3DPointFloat(g_actorLODs[i + 1].m_direction),
-			Mx3DPointFloat(g_actorLODs[i + 1].m_up),
-			mat
-		);
-		childROI->WrappedSetLocal2WorldWithWorldDataUpdate(mat);
+	roi->WrappedSetLocal2WorldWithWorldDataUpdate(g_actorPartLayouts[c_topLOD].m_local);
+	success = TRUE;
+
+done:
+	if (!success && roi != NULL) {
+		delete roi;
+		roi = NULL;
+	}
 
-		if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useTexture &&
-			(i != 0 || part.m_partNameIndices[part.m_partNameIndex] != 0)) {
+	return roi;
+}
 
-			LegoTextureInfo* textureInfo = textureContainer->Get(part.m_names[part.m_nameIndices[part.m_nameIndex]]);
+// Returns the prepared LOD list of a part in one appearance: 't' for a texture, 'c' for a color or 'n' for
+// the part as loaded. The first request clones the part's meshes and applies the appearance; later requests
+// for the same combination share that list. Appearance changes on a single actor go through UnsharePartLODs().
+// The returned list's refCount is increased, i.e. the caller must call Release().
+ViewLODList* LegoCharacterManager::GetPartTemplate(
+	const char* p_lodName,
+	char p_appearanceType,
+	const char* p_appearance
+)
+{
+	char key[256];
+	SDL_snprintf(key, sizeof(key), "%s:%c:%s", p_lodName, p_appearanceType, p_appearance);
 
-			if (textureInfo != NULL) {
-				childROI->SetTextureInfo(textureInfo);
-				childROI->SetLodColor(1.0F, 1.0F, 1.0F, 0.0F);
-			}
+	ViewLODList* lodList;
+	LegoPartTemplateMap::iterator it = m_partTemplates->find(key);
+
+	if (it != m_partTemplates->end()) {
+		lodList = (*it).second;
+		lodList->AddRef();
+		return lodList;
+	}
+
+	ViewLODList* sourceList = GetViewLODListManager()->Lookup(p_lodName);
+
+	if (sourceList == NULL) {
+		return NULL;
+	}
+
+	lodList = CloneLODList(sourceList, key);
+	sourceList->Release();
+
+	LegoTextureInfo* textureInfo = NULL;
+	LegoFloat red, green, blue, alpha;
+
+	if (p_appearanceType == 't') {
+		textureInfo = TextureContainer()->Get(p_appearance);
+	}
+	else if (p_appearanceType == 'c') {
+		LegoROI::GetRGBAColor(p_appearance, red, green, blue, alpha);
+	}
+
+	for (MxS32 i = 0; i < lodList->Size(); i++) {
+		LegoLOD* lod = (LegoLOD*) (*lodList)[i];
+
+		if (textureInfo != NULL) {
+			lod->SetTextureInfo(textureInfo);
+			lod->SetColor(1.0F, 1.0F, 1.0F, 0.0F);
 		}
-		else if (g_actorLODs[i + 1].m_flags & LegoActorLOD::c_useColor || (i == 0 && part.m_partNameIndices[part.m_partNameIndex] == 0)) {
-			LegoFloat red, green, blue, alpha;
-			childROI->GetRGBAColor(part.m_names[part.m_nameIndices[part.m_nameIndex]], red, green, blue, alpha);
-			childROI->SetLodColor(red, green, blue, alpha);
+		else if (p_appearanceType == 'c') {
+			lod->SetColor(red, green, blue, alpha);
 		}
+	}
 
-		comp->push_back(childROI);
+	char* name = new char[strlen(key) + 1];
+	strcpy(name, key);
+	(*m_partTemplates)[name] = lodList;
+
+	// One reference stays with the cache
+	lodList->AddRef();
+	return lodList;
+}
+
+// Gives an actor part ROI its own copy of a shared part template, so that its appearance can be changed in place
+void LegoCharacterManager::UnsharePartLODs(LegoROI* p_roi)
+{
+	ViewLODList* lodList = reinterpret_cast<ViewLODList*>(const_cast<LODListBase*>(p_roi->GetLODs()));
+	LegoPartTemplateMap::iterator it;
+
+	if (lodList == NULL) {
+		return;
 	}
 
-	CalcLocalTransform(
-		Mx3DPointFloat(g_actorLODs[c_topLOD].m_position),
-		Mx3DPointFloat(g_actorLODs[c_topLOD].m_direction),
-		Mx3DPointFloat(g_actorLODs[c_topLOD].m_up),
-		mat
-	);
-	roi->WrappedSetLocal2WorldWithWorldDataUpdate(mat);
+	for (it = m_partTemplates->begin(); it != m_partTemplates->end(); it++) {
+		if ((*it).second == lodList) {
+			break;
+		}
+	}
 
-	info->m_roi = roi;
-	success = TRUE;
+	if (it == m_partTemplates->end()) {
+		return;
+	}
 
-done:
-	if (!success && roi != NULL) {
-		delete roi;
-		roi = NULL;
+	char lodName[256];
+	SDL_snprintf(lodName, sizeof(lodName), "%s%s%d", p_roi->GetName(), "part", g_partLODCounter++);
+	ViewLODList* dupLodList = CloneLODList(lodList, lodName);
+
+	if (p_roi->GetLodLevel() >= 0) {
+		VideoManager()->Get3DManager()->GetLego3DView()->GetViewManager()->RemoveROIDetailFromScene(p_roi);
 	}
 
-	return roi;
+	p_roi->SetLODList(dupLodList);
+	dupLodList->Release();
 }
 
 // FUNCTION: LEGO1 0x100849a0
@@ -807,6 +931,7 @@ MxBool LegoCharacterManager::SwitchColor(LegoROI* p_roi, LegoROI* p_targetROI)
 
 	LegoFloat red, green, blue, alpha;
 	LegoROI::GetRGBAColor(part.m_names[part.m_nameIndices[part.m_nameIndex]], red, green, blue, alpha);
+	UnsharePartLODs(p_targetROI);
 	p_targetROI->SetLodColor(red, green, blue, alpha);
 	return TRUE;
 }
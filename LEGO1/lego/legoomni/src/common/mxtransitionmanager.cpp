@@ -170,6 +170,34 @@ void MxTransitionManager::NoTransition()
 	EndTransition(TRUE);
 }
 
+// Sets the chosen columns to black. Each column is shifted a different amount at each scanline, using
+// the same shift for that scanline each time, so by the end every pixel gets hit. The surface is walked
+// row by row, with the pixel format resolved once rather than per pixel.
+template <class T>
+static void DissolveColumns(
+	MxU8* p_surface,
+	MxLong p_pitch,
+	const MxU16* p_shift,
+	const MxS32* p_columns,
+	MxS32 p_numColumns,
+	T p_black
+)
+{
+	for (MxS32 row = 0; row < 480; row++) {
+		T* line = (T*) (p_surface + p_pitch * row);
+		MxS32 shift = p_shift[row];
+
+		for (MxS32 i = 0; i < p_numColumns; i++) {
+			MxS32 x = shift + p_columns[i];
+			if (x >= 640) {
+				x -= 640;
+			}
+
+			line[x] = p_black;
+		}
+	}
+}
+
 // FUNCTION: LEGO1 0x1004bd10
 void MxTransitionManager::DissolveTransition()
 {
@@ -216,36 +244,28 @@ void MxTransitionManager::DissolveTransition()
 	if (res == DD_OK) {
 		SubmitCopyRect(&ddsd);
 
-		for (MxS32 col = 0; col < 640; col++) {
-			// Select 16 columns on each tick
-			if (m_animationTimer * 16 > m_columnOrder[col]) {
-				continue;
-			}
+		// Select 16 columns on each tick
+		MxS32 columns[16];
+		MxS32 numColumns = 0;
 
-			if (m_animationTimer * 16 + 15 < m_columnOrder[col]) {
-				continue;
+		for (MxS32 col = 0; col < 640; col++) {
+			if (m_animationTimer * 16 <= m_columnOrder[col] && m_columnOrder[col] <= m_animationTimer * 16 + 15) {
+				columns[numColumns++] = col;
 			}
+		}
 
-			for (MxS32 row = 0; row < 480; row++) {
-				// Shift the chosen column a different amount at each scanline.
-				// We use the same shift for that scanline each time.
-				// By the end, every pixel gets hit.
-				MxS32 xShift = (m_randomShift[row] + col) % 640;
-
-				// Set the chosen pixel to black
-				if (ddsd.ddpfPixelFormat.dwRGBBitCount == 8) {
-					MxU8* surf = (MxU8*) ddsd.lpSurface + ddsd.lPitch * row + xShift;
-					*surf = 0;
-				}
-				else if (ddsd.ddpfPixelFormat.dwRGBBitCount == 16) {
-					MxU8* surf = (MxU8*) ddsd.lpSurface + ddsd.lPitch * row + xShift * 2;
-					*(MxU16*) surf = 0;
-				}
-				else {
-					MxU8* surf = (MxU8*) ddsd.lpSurface + ddsd.lPitch * row + xShift * 4;
-					*(MxU32*) surf = 0xFF000000;
-				}
-			}
+		MxU8* surface = (MxU8*) ddsd.lpSurface;
+
+		switch (ddsd.ddpfPixelFormat.dwRGBBitCount) {
+		case 8:
+			DissolveColumns<MxU8>(surface, ddsd.lPitch, m_randomShift, columns, numColumns, 0);
+			break;
+		case 16:
+			DissolveColumns<MxU16>(surface, ddsd.lPitch, m_randomShift, columns, numColumns, 0);
+			break;
+		default:
+			DissolveColumns<MxU32>(surface, ddsd.lPitch, m_randomShift, columns, numColumns, 0xFF000000);
+			break;
 		}
 
 		SetupCopyRect(&ddsd);
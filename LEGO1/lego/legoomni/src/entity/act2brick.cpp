@@ -125,7 +125,7 @@ MxResult Act2Brick::HitActor(LegoPathActor* p_actor, MxBool)
 
 	g_lastHitActorTime = time;
 	if (diff > 1000) {
-		SoundManager()->GetCacheSoundManager()->Play("hitactor", NULL, FALSE);
+		SoundManager()->GetCacheSoundManager()->PlayOneShot("hitactor", NULL);
 	}
 
 	return SUCCESS;
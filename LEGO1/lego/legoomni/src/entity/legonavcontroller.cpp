@@ -28,6 +28,7 @@
 #include "viewmanager/viewmanager.h"
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
 #include <vec.h>
 
 using namespace Extensions;
@@ -347,6 +348,9 @@ MxBool LegoNavController::CalculateNewPosDir(
 	float deltaTime = Min((currentTime - m_lastTime) / 1000.0, 1. / 10.);
 	m_lastTime = currentTime;
 
+	float prevTargetLinearVel = m_targetLinearVel;
+	float prevTargetRotationalVel = m_targetRotationalVel;
+
 	if (ProcessKeyboardInput() == FAILURE) {
 		ProcessJoystickInput(rotatedY);
 	}
@@ -357,14 +361,40 @@ MxBool LegoNavController::CalculateNewPosDir(
 		return TRUE;
 	}
 
+	// Input that arrived during the frame only drives the velocities from the moment it arrived;
+	// before that the previous targets still apply. Keeps acceleration independent of frame timing.
+	float inputTime = deltaTime;
+	LegoInputManager* inputManager = InputManager();
+
+	if (inputManager != NULL && inputManager->GetNavigationInputTime()) {
+		Uint64 now = SDL_GetTicksNS();
+		Uint64 arrival = inputManager->GetNavigationInputTime();
+
+		if (arrival <= now && now - arrival < (Uint64) (deltaTime * 1000000000.0f)) {
+			inputTime = (now - arrival) / 1000000000.0f;
+			float earlierTime = deltaTime - inputTime;
+
+			if (m_useRotationalVel) {
+				m_rotationalVel = CalculateNewVel(
+					prevTargetRotationalVel,
+					m_rotationalVel,
+					m_rotationalAccel * 40.0f,
+					earlierTime
+				);
+			}
+
+			m_linearVel = CalculateNewVel(prevTargetLinearVel, m_linearVel, m_linearAccel, earlierTime);
+		}
+	}
+
 	if (m_useRotationalVel) {
-		m_rotationalVel = CalculateNewVel(m_targetRotationalVel, m_rotationalVel, m_rotationalAccel * 40.0f, deltaTime);
+		m_rotationalVel = CalculateNewVel(m_targetRotationalVel, m_rotationalVel, m_rotationalAccel * 40.0f, inputTime);
 	}
 	else {
 		m_rotationalVel = m_targetRotationalVel * m_maxRotationalVel * deltaTime;
 	}
 
-	m_linearVel = CalculateNewVel(m_targetLinearVel, m_linearVel, m_linearAccel, deltaTime);
+	m_linearVel = CalculateNewVel(m_targetLinearVel, m_linearVel, m_linearAccel, inputTime);
 
 	if (rotatedY || (Abs(m_rotationalVel) > m_zeroThreshold) || (Abs(m_linearVel) > m_zeroThreshold)) {
 		float rot_mat[3][3];
@@ -27,6 +27,7 @@
 #include "mxstl/stlcompat.h"
 #include "mxutilities.h"
 
+#include <SDL3/SDL_filesystem.h>
 #include <SDL3/SDL_stdinc.h>
 #include <stdio.h>
 
@@ -38,6 +39,46 @@ MxS32 g_legoWorldPresenterQuality = 1;
 // GLOBAL: LEGO1 0x100f75d8
 Sint64 g_wdbSkipGlobalPartsOffset = 0;
 
+// The world.wdb directory lists every world and is the same for all of them, so it is parsed once and kept
+// until world.wdb itself changes
+ModelDbWorld* g_modelDbWorlds = NULL;
+MxS32 g_numModelDbWorlds = 0;
+Sint64 g_modelDbDirectoryEnd = 0;
+char g_modelDbPath[512] = "";
+SDL_PathInfo g_modelDbPathInfo;
+
+// Leaves p_wdbFile positioned after the directory, as reading it would
+static MxResult ReadCachedModelDbWorlds(SDL_IOStream* p_wdbFile, const char* p_wdbPath)
+{
+	SDL_PathInfo pathInfo;
+
+	if (!SDL_GetPathInfo(p_wdbPath, &pathInfo)) {
+		SDL_zero(pathInfo);
+	}
+
+	if (g_modelDbWorlds != NULL && !strcmp(g_modelDbPath, p_wdbPath) && pathInfo.size == g_modelDbPathInfo.size &&
+		pathInfo.modify_time == g_modelDbPathInfo.modify_time) {
+		if (SDL_SeekIO(p_wdbFile, g_modelDbDirectoryEnd, SDL_IO_SEEK_SET) != g_modelDbDirectoryEnd) {
+			return FAILURE;
+		}
+
+		return SUCCESS;
+	}
+
+	LegoWorldPresenter::ReleaseModelDb();
+
+	if (ReadModelDbWorlds(p_wdbFile, g_modelDbWorlds, g_numModelDbWorlds) != SUCCESS) {
+		return FAILURE;
+	}
+
+	// Offsets into a different file are meaningless
+	g_wdbSkipGlobalPartsOffset = 0;
+	g_modelDbDirectoryEnd = SDL_TellIO(p_wdbFile);
+	SDL_strlcpy(g_modelDbPath, p_wdbPath, sizeof(g_modelDbPath));
+	g_modelDbPathInfo = pathInfo;
+	return SUCCESS;
+}
+
 // FUNCTION: LEGO1 0x100665b0
 void LegoWorldPresenter::configureLegoWorldPresenter(MxS32 p_legoWorldPresenterQuality)
 {
@@ -191,12 +232,17 @@ MxResult LegoWorldPresenter::LoadWorld(char* p_worldName, LegoWorld* p_world)
 		}
 	}
 
-	ModelDbWorld* worlds = NULL;
-	MxS32 numWorlds, i, j;
+	MxS32 i, j;
 	MxU32 size;
 	MxU8* buff;
 
-	ReadModelDbWorlds(wdbFile, worlds, numWorlds);
+	if (ReadCachedModelDbWorlds(wdbFile, wdbPath) != SUCCESS) {
+		SDL_CloseIO(wdbFile);
+		return FAILURE;
+	}
+
+	ModelDbWorld* worlds = g_modelDbWorlds;
+	MxS32 numWorlds = g_numModelDbWorlds;
 
 	for (i = 0; i < numWorlds; i++) {
 		if (!SDL_strcasecmp(worlds[i].m_worldName, p_worldName)) {
@@ -312,11 +358,17 @@ MxResult LegoWorldPresenter::LoadWorld(char* p_worldName, LegoWorld* p_world)
 		}
 	}
 
-	FreeModelDbWorlds(worlds, numWorlds);
 	SDL_CloseIO(wdbFile);
 	return SUCCESS;
 }
 
+void LegoWorldPresenter::ReleaseModelDb()
+{
+	FreeModelDbWorlds(g_modelDbWorlds, g_numModelDbWorlds);
+	g_numModelDbWorlds = 0;
+	g_modelDbPath[0] = '\0';
+}
+
 // FUNCTION: LEGO1 0x10067360
 MxResult LegoWorldPresenter::LoadWorldPart(ModelDbPart& p_part, SDL_IOStream* p_wdbFile)
 {
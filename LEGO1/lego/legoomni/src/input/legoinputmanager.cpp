@@ -88,6 +88,18 @@ MxResult LegoInputManager::Create(HWND p_hwnd)
 // FUNCTION: LEGO1 0x1005bfe0
 void LegoInputManager::Destroy()
 {
+	if (m_inputLatencyFrames) {
+		SDL_LogDebug(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"Input: %u frames showed new input, %.1f ms average and %.1f ms peak from event to rendered frame",
+			m_inputLatencyFrames,
+			m_inputLatencyTotal / (double) m_inputLatencyFrames / 1000000.0,
+			m_inputLatencyPeak / 1000000.0
+		);
+
+		m_inputLatencyFrames = 0;
+	}
+
 	if (m_keyboardNotifyList) {
 		delete m_keyboardNotifyList;
 	}
@@ -815,6 +827,8 @@ void LegoInputManager::InitializeHaptics()
 
 void LegoInputManager::UpdateLastInputMethod(SDL_Event* p_event)
 {
+	TrackInputTime(p_event);
+
 	switch (p_event->type) {
 	case SDL_EVENT_KEY_DOWN:
 	case SDL_EVENT_KEY_UP:
@@ -842,3 +856,51 @@ void LegoInputManager::UpdateLastInputMethod(SDL_Event* p_event)
 		break;
 	}
 }
+
+void LegoInputManager::TrackInputTime(SDL_Event* p_event)
+{
+	switch (p_event->type) {
+	case SDL_EVENT_KEY_DOWN:
+	case SDL_EVENT_KEY_UP:
+		if (!p_event->key.repeat) {
+			m_navigationInputTime = p_event->common.timestamp;
+		}
+		break;
+	case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+	case SDL_EVENT_GAMEPAD_BUTTON_UP:
+	case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+	case SDL_EVENT_FINGER_MOTION:
+	case SDL_EVENT_FINGER_DOWN:
+	case SDL_EVENT_FINGER_UP:
+	case SDL_EVENT_FINGER_CANCELED:
+		m_navigationInputTime = p_event->common.timestamp;
+		break;
+	case SDL_EVENT_MOUSE_BUTTON_DOWN:
+	case SDL_EVENT_MOUSE_BUTTON_UP:
+	case SDL_EVENT_MOUSE_MOTION:
+		break;
+	default:
+		return;
+	}
+
+	if (!m_pendingInputTime) {
+		m_pendingInputTime = p_event->common.timestamp;
+	}
+}
+
+void LegoInputManager::FrameCompleted()
+{
+	if (!m_pendingInputTime) {
+		return;
+	}
+
+	Uint64 now = SDL_GetTicksNS();
+	if (now > m_pendingInputTime) {
+		Uint64 latency = now - m_pendingInputTime;
+		m_inputLatencyTotal += latency;
+		m_inputLatencyPeak = SDL_max(m_inputLatencyPeak, latency);
+		m_inputLatencyFrames++;
+	}
+
+	m_pendingInputTime = 0;
+}
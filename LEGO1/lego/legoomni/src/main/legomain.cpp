@@ -19,6 +19,7 @@
 #include "legovideomanager.h"
 #include "legoworld.h"
 #include "legoworldlist.h"
+#include "legoworldpresenter.h"
 #include "misc.h"
 #include "misc/legocontainer.h"
 #include "mxactionnotificationparam.h"
@@ -133,6 +134,7 @@ void LegoOmni::Destroy()
 	}
 
 	LegoPartPresenter::Release();
+	LegoWorldPresenter::ReleaseModelDb();
 
 	if (m_viewLODListManager) {
 		delete m_viewLODListManager;
@@ -234,7 +234,7 @@ MxResult LegoExtraActor::HitActor(LegoPathActor* p_actor, MxBool p_bool)
 				InitializeReassemblyAnim();
 				assert(m_roi);
 				assert(SoundManager()->GetCacheSoundManager());
-				SoundManager()->GetCacheSoundManager()->Play("crash5", m_roi->GetName(), FALSE);
+				SoundManager()->GetCacheSoundManager()->PlayOneShot("crash5", m_roi->GetName());
 				if (p_actor->GetUserNavFlag()) {
 					EmitGameEvent(e_hitActor);
 				}
@@ -250,7 +250,7 @@ MxResult LegoExtraActor::HitActor(LegoPathActor* p_actor, MxBool p_bool)
 		if (b) {
 			LegoROI* roi = GetROI();
 			assert(roi);
-			SoundManager()->GetCacheSoundManager()->Play("crash5", m_roi->GetName(), FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("crash5", m_roi->GetName());
 			if (p_actor->GetUserNavFlag()) {
 				EmitGameEvent(e_hitActor);
 			}
@@ -312,7 +312,7 @@ MxS32 LegoPathActor::CalculateTransform(float p_time, Matrix4& p_transform)
 						const char* var = VariableTable()->GetVariable(g_strHIT_WALL_SOUND);
 
 						if (var && var[0] != 0) {
-							SoundManager()->GetCacheSoundManager()->Play(var, NULL, FALSE);
+							SoundManager()->GetCacheSoundManager()->PlayOneShot(var, NULL);
 						}
 					}
 
@@ -494,28 +494,27 @@ MxU32 LegoPathActor::CheckPresenterAndActorIntersections(
 	}
 
 	LegoPathActorSet& plpas = p_boundary->GetActors();
-	LegoPathActorSet lpas(plpas);
-
-	for (LegoPathActorSet::iterator itpa = lpas.begin(); itpa != lpas.end(); itpa++) {
-		if (plpas.find(*itpa) != plpas.end()) {
-			LegoPathActor* actor = *itpa;
-
-			if (this != actor && !(actor->GetActorState() & LegoPathActor::c_noCollide)) {
-				LegoROI* roi = actor->GetROI();
-
-				if (roi != NULL && (roi->GetVisibility() || actor->GetCameraFlag())) {
-					if (roi->Intersect(
-							p_rayOrigin,
-							p_rayDirection,
-							p_rayLength,
-							p_radius,
-							p_intersectionPoint,
-							m_collideBox && actor->m_collideBox
-						)) {
-						HitActor(actor, TRUE);
-						actor->HitActor(this, FALSE);
-						return 2;
-					}
+
+	// Nothing below changes the set before returning, so it is walked in place rather than copied
+	// for every boundary an actor checks on every step
+	for (LegoPathActorSet::iterator itpa = plpas.begin(); itpa != plpas.end(); itpa++) {
+		LegoPathActor* actor = *itpa;
+
+		if (this != actor && !(actor->GetActorState() & LegoPathActor::c_noCollide)) {
+			LegoROI* roi = actor->GetROI();
+
+			if (roi != NULL && (roi->GetVisibility() || actor->GetCameraFlag())) {
+				if (roi->Intersect(
+						p_rayOrigin,
+						p_rayDirection,
+						p_rayLength,
+						p_radius,
+						p_intersectionPoint,
+						m_collideBox && actor->m_collideBox
+					)) {
+					HitActor(actor, TRUE);
+					actor->HitActor(this, FALSE);
+					return 2;
 				}
 			}
 		}
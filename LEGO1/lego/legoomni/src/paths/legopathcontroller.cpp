@@ -381,10 +381,13 @@ void LegoPathController::AnimateActors()
 {
 	float time = Timer()->GetTime();
 
-	LegoPathActorSet lpas(m_actors);
+	// Taken out of the member while in use, in case an actor's Animate ends up back in here
+	std::vector<LegoPathActor*> lpas;
+	lpas.swap(m_animateActors);
+	lpas.assign(m_actors.begin(), m_actors.end());
 
-	for (LegoPathActorSet::iterator itpa = lpas.begin(); itpa != lpas.end(); itpa++) {
-		LegoPathActor* actor = *itpa;
+	for (size_t i = 0; i < lpas.size(); i++) {
+		LegoPathActor* actor = lpas[i];
 
 		if (m_actors.find(actor) != m_actors.end()) {
 			if (!((MxU8) actor->GetActorState() & LegoPathActor::c_disabled)) {
@@ -392,6 +395,9 @@ void LegoPathController::AnimateActors()
 			}
 		}
 	}
+
+	lpas.clear();
+	m_animateActors.swap(lpas);
 }
 
 // FUNCTION: LEGO1 0x10046b30
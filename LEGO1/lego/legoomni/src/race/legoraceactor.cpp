@@ -36,7 +36,7 @@ MxS32 LegoRaceActor::CheckIntersections(Vector3& p_rayOrigin, Vector3& p_rayEnd,
 			const char* soundKey = VariableTable()->GetVariable(g_strHIT_ACTOR_SOUND);
 
 			if (soundKey && *soundKey) {
-				SoundManager()->GetCacheSoundManager()->Play(soundKey, NULL, FALSE);
+				SoundManager()->GetCacheSoundManager()->PlayOneShot(soundKey, NULL);
 			}
 		}
 	}
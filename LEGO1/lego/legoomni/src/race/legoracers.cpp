@@ -391,7 +391,7 @@ MxU32 LegoRaceCar::HandleSkeletonKicks(float p_param1)
 	}
 
 	m_kickStart = p_param1;
-	SoundManager()->GetCacheSoundManager()->Play(g_soundSkel3, NULL, FALSE);
+	SoundManager()->GetCacheSoundManager()->PlayOneShot(g_soundSkel3, NULL);
 	EmitGameEvent(e_skeletonKick);
 
 	return TRUE;
@@ -450,7 +450,7 @@ void LegoRaceCar::Animate(float p_time)
 
 		// If the player hasn't moved in 5 seconds, play the "you can't stop in the middle of the race!" sound once
 		if (p_time - g_timePlayerLastMoved > 5000.0f && !g_playedYouCantStopSound) {
-			SoundManager()->GetCacheSoundManager()->Play(g_youCantStopSound, NULL, 0);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot(g_youCantStopSound, NULL);
 			g_playedYouCantStopSound = TRUE;
 		}
 	}
@@ -516,7 +516,7 @@ MxResult LegoRaceCar::HitActor(LegoPathActor* p_actor, MxBool p_bool)
 				}
 
 				if (soundKey) {
-					SoundManager()->GetCacheSoundManager()->Play(soundKey, NULL, FALSE);
+					SoundManager()->GetCacheSoundManager()->PlayOneShot(soundKey, NULL);
 					g_timeLastRaceCarSoundPlayed = g_timeLastHitSoundPlayed = time;
 				}
 			}
@@ -717,7 +717,7 @@ MxResult LegoJetski::HitActor(LegoPathActor* p_actor, MxBool p_bool)
 				}
 
 				if (soundKey) {
-					SoundManager()->GetCacheSoundManager()->Play(soundKey, NULL, FALSE);
+					SoundManager()->GetCacheSoundManager()->PlayOneShot(soundKey, NULL);
 					g_timeLastJetskiSoundPlayed = g_timeLastHitSoundPlayed = time;
 				}
 			}
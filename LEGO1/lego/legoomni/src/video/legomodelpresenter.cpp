@@ -6,11 +6,11 @@
 #include "legocharactermanager.h"
 #include "legoentity.h"
 #include "legoentitypresenter.h"
+#include "legotextureloadjob.h"
 #include "legovideomanager.h"
 #include "legoworld.h"
 #include "misc.h"
 #include "misc/legocontainer.h"
-#include "misc/legotexture.h"
 #include "misc/version.h"
 #include "mxcompositepresenter.h"
 #include "mxdirectx/mxdirect3d.h"
@@ -21,7 +21,7 @@
 
 #include <SDL3/SDL_stdinc.h>
 
-DECOMP_SIZE_ASSERT(LegoModelPresenter, 0x6c)
+DECOMP_SIZE_ASSERT(LegoModelPresenter, 0x70)
 
 // GLOBAL: LEGO1 0x100f7ae0
 MxS32 g_modelPresenterConfig = 1;
@@ -36,6 +36,10 @@ void LegoModelPresenter::configureLegoModelPresenter(MxS32 p_modelPresenterConfi
 void LegoModelPresenter::Destroy(MxBool p_fromDestructor)
 {
 	ENTER(m_criticalSection);
+
+	// The chunk the job reads from is freed with the other media presenter state
+	CancelTextureLoad();
+
 	m_roi = NULL;
 	m_addedToView = FALSE;
 	m_criticalSection.Leave();
@@ -47,19 +51,23 @@ void LegoModelPresenter::Destroy(MxBool p_fromDestructor)
 
 // FUNCTION: LEGO1 0x1007f6b0
 // STUB: BETA10 0x1009845e
-MxResult LegoModelPresenter::CreateROI(MxDSChunk* p_chunk)
+MxResult LegoModelPresenter::CreateROI(MxDSChunk* p_chunk, LegoTextureLoadJob* p_textures)
 {
 	MxResult result = FAILURE;
 	LegoU32 numROIs;
 	Mx3DPointFloat vect;
 	LegoMemory storage(p_chunk->GetData(), p_chunk->GetLength());
 	LegoAnim anim;
-	LegoU32 version, textureInfoOffset, i, numTextures, skipTextures;
+	LegoU32 version;
 	MxMatrix mat;
-	LegoChar* textureName = NULL;
-	LegoTexture* texture = NULL;
-	LegoTextureInfo* textureInfo = NULL;
 	LegoS32 hardwareMode = VideoManager()->GetDirect3D()->AssignedDevice()->GetHardwareMode();
+	LegoTextureLoadJob textures(
+		p_chunk->GetData(),
+		p_chunk->GetLength(),
+		LegoTextureLoadJob::e_model,
+		g_modelPresenterConfig,
+		hardwareMode
+	);
 
 	if (m_roi) {
 		delete m_roi;
@@ -74,80 +82,14 @@ MxResult LegoModelPresenter::CreateROI(MxDSChunk* p_chunk)
 	if (version != MODEL_VERSION) {
 		goto done;
 	}
-	if (storage.Read(&textureInfoOffset, sizeof(LegoU32)) != SUCCESS) {
-		goto done;
-	}
-
-	storage.SetPosition(textureInfoOffset);
 
-	if (storage.Read(&numTextures, sizeof(LegoU32)) != SUCCESS) {
-		goto done;
+	if (p_textures == NULL) {
+		textures.Run();
+		p_textures = &textures;
 	}
-	if (storage.Read(&skipTextures, sizeof(LegoU32)) != SUCCESS) {
-		goto done;
-	}
-
-	for (i = 0; i < numTextures; i++) {
-		LegoU32 textureNameLength;
-
-		storage.Read(&textureNameLength, sizeof(LegoU32));
-		textureName = new LegoChar[textureNameLength + 1];
-		storage.Read(textureName, textureNameLength);
-		textureName[textureNameLength] = '\0';
-
-		SDL_strlwr(textureName);
-
-		if (textureName[0] == '^') {
-			memmove(textureName, textureName + 1, strlen(textureName));
-
-			if (g_modelPresenterConfig) {
-				texture = new LegoTexture();
-				if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-					goto done;
-				}
-
-				LegoTexture* discardTexture = new LegoTexture();
-				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
-					goto done;
-				}
-				delete discardTexture;
-			}
-			else {
-				LegoTexture* discardTexture = new LegoTexture();
-				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
-					goto done;
-				}
-				delete discardTexture;
-
-				texture = new LegoTexture();
-				if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-					goto done;
-				}
-			}
-		}
-		else {
-			texture = new LegoTexture();
-			if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-				goto done;
-			}
-		}
 
-		if (!skipTextures) {
-			if (TextureContainer()->Get(textureName) == NULL) {
-				textureInfo = LegoTextureInfo::Create(textureName, texture);
-
-				if (textureInfo == NULL) {
-					goto done;
-				}
-
-				TextureContainer()->Add(textureName, textureInfo);
-			}
-
-			delete[] textureName;
-			textureName = NULL;
-			delete texture;
-			texture = NULL;
-		}
+	if (p_textures->Store() != SUCCESS) {
+		goto done;
 	}
 
 	storage.SetPosition(8);
@@ -179,12 +121,6 @@ MxResult LegoModelPresenter::CreateROI(MxDSChunk* p_chunk)
 	result = SUCCESS;
 
 done:
-	if (textureName != NULL) {
-		delete[] textureName;
-	}
-	if (texture != NULL) {
-		delete texture;
-	}
 	if (result != SUCCESS) {
 		if (m_roi) {
 			delete m_roi;
@@ -256,33 +192,73 @@ void LegoModelPresenter::ReadyTickle()
 		EndAction();
 	}
 	else {
-		MxStreamChunk* chunk = m_subscriber->PeekData();
-
-		if (chunk != NULL && chunk->GetTime() <= m_action->GetElapsedTime()) {
-			chunk = m_subscriber->PopData();
-			MxResult result = CreateROI(chunk);
-			m_subscriber->FreeDataChunk(chunk);
-
-			if (result == SUCCESS) {
-				VideoManager()->Get3DManager()->Add(*m_roi);
-				VideoManager()->Get3DManager()->Moved(*m_roi);
-
-				if (m_compositePresenter != NULL && m_compositePresenter->IsA("LegoEntityPresenter")) {
-					((LegoEntityPresenter*) m_compositePresenter)->GetInternalEntity()->SetROI(m_roi, TRUE, TRUE);
-					((LegoEntityPresenter*) m_compositePresenter)
-						->GetInternalEntity()
-						->SetFlags(
-							((LegoEntityPresenter*) m_compositePresenter)->GetInternalEntity()->GetFlags() &
-							~LegoEntity::c_managerOwned
-						);
-				}
+		if (m_textureLoadJob == NULL) {
+			MxStreamChunk* chunk = m_subscriber->PeekData();
 
-				ParseExtra();
-				ProgressTickleState(e_starting);
+			if (chunk == NULL || chunk->GetTime() > m_action->GetElapsedTime()) {
+				return;
 			}
 
-			EndAction();
+			// Decode the textures in the background; the presenter stays ready until they are done.
+			// The chunk stays at the head of the subscriber's queue until then, so a stop chunk
+			// cannot end the action underneath the job.
+			m_textureLoadJob = new LegoTextureLoadJob(
+				chunk->GetData(),
+				chunk->GetLength(),
+				LegoTextureLoadJob::e_model,
+				g_modelPresenterConfig,
+				VideoManager()->GetDirect3D()->AssignedDevice()->GetHardwareMode()
+			);
+			MxJobPool::Schedule(m_textureLoadJob);
 		}
+
+		if (!m_textureLoadJob->IsDone()) {
+			return;
+		}
+
+		m_currentChunk = m_subscriber->PopData();
+		MxResult result = CreateROI(m_currentChunk, m_textureLoadJob);
+
+		delete m_textureLoadJob;
+		m_textureLoadJob = NULL;
+		m_subscriber->FreeDataChunk(m_currentChunk);
+		m_currentChunk = NULL;
+
+		if (result == SUCCESS) {
+			VideoManager()->Get3DManager()->Add(*m_roi);
+			VideoManager()->Get3DManager()->Moved(*m_roi);
+
+			if (m_compositePresenter != NULL && m_compositePresenter->IsA("LegoEntityPresenter")) {
+				((LegoEntityPresenter*) m_compositePresenter)->GetInternalEntity()->SetROI(m_roi, TRUE, TRUE);
+				((LegoEntityPresenter*) m_compositePresenter)
+					->GetInternalEntity()
+					->SetFlags(
+						((LegoEntityPresenter*) m_compositePresenter)->GetInternalEntity()->GetFlags() &
+						~LegoEntity::c_managerOwned
+					);
+			}
+
+			ParseExtra();
+			ProgressTickleState(e_starting);
+		}
+
+		EndAction();
+	}
+}
+
+void LegoModelPresenter::EndAction()
+{
+	// The subscriber frees the chunk a pending job reads from
+	CancelTextureLoad();
+	MxVideoPresenter::EndAction();
+}
+
+void LegoModelPresenter::CancelTextureLoad()
+{
+	if (m_textureLoadJob) {
+		MxJobPool::Cancel(m_textureLoadJob);
+		delete m_textureLoadJob;
+		m_textureLoadJob = NULL;
 	}
 }
 
@@ -1,10 +1,10 @@
 #include "legopartpresenter.h"
 
+#include "legotextureloadjob.h"
 #include "legovideomanager.h"
 #include "misc.h"
 #include "misc/legocontainer.h"
 #include "misc/legostorage.h"
-#include "misc/legotexture.h"
 #include "mxdirectx/mxdirect3d.h"
 #include "mxdsaction.h"
 #include "mxdssubscriber.h"
@@ -44,6 +44,9 @@ void LegoPartPresenter::Destroy(MxBool p_fromDestructor)
 	ENTER(m_criticalSection);
 	VideoManager()->UnregisterPresenter(*this);
 
+	// The chunk the job reads from is freed with the other media presenter state
+	CancelTextureLoad();
+
 	if (m_parts) {
 		delete m_parts;
 		m_parts = NULL;
@@ -57,90 +60,32 @@ void LegoPartPresenter::Destroy(MxBool p_fromDestructor)
 }
 
 // FUNCTION: LEGO1 0x1007ca30
-MxResult LegoPartPresenter::Read(MxDSChunk& p_chunk)
+MxResult LegoPartPresenter::Read(MxDSChunk& p_chunk, LegoTextureLoadJob* p_textures)
 {
 	MxResult result = FAILURE;
 	LegoU32 numROIs, numLODs;
 	LegoMemory storage(p_chunk.GetData(), p_chunk.GetLength());
-	LegoU32 textureInfoOffset, i, j, numTextures;
+	LegoU32 j, i;
 	LegoU32 roiNameLength, roiInfoOffset, surplusLODs;
 	LegoLODList* lods;
 	LegoNamedPart* namedPart;
 	LegoChar* roiName = NULL;
-	LegoChar* textureName = NULL;
-	LegoTexture* texture = NULL;
-	LegoTextureInfo* textureInfo = NULL;
 	LegoS32 hardwareMode = VideoManager()->GetDirect3D()->AssignedDevice()->GetHardwareMode();
-
-	if (storage.Read(&textureInfoOffset, sizeof(LegoU32)) != SUCCESS) {
-		goto done;
-	}
-	if (storage.SetPosition(textureInfoOffset) != SUCCESS) {
-		goto done;
-	}
-	if (storage.Read(&numTextures, sizeof(LegoU32)) != SUCCESS) {
-		goto done;
+	LegoTextureLoadJob textures(
+		p_chunk.GetData(),
+		p_chunk.GetLength(),
+		LegoTextureLoadJob::e_part,
+		g_partPresenterConfig1,
+		hardwareMode
+	);
+
+	if (p_textures == NULL) {
+		textures.Run();
+		p_textures = &textures;
 	}
 
-	for (i = 0; i < numTextures; i++) {
-		LegoU32 textureNameLength;
-
-		storage.Read(&textureNameLength, sizeof(LegoU32));
-		textureName = new LegoChar[textureNameLength + 1];
-		storage.Read(textureName, textureNameLength);
-		textureName[textureNameLength] = '\0';
-
-		SDL_strlwr(textureName);
-
-		if (textureName[0] == '^') {
-			memmove(textureName, textureName + 1, strlen(textureName));
-
-			if (g_partPresenterConfig1) {
-				texture = new LegoTexture();
-				if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-					goto done;
-				}
-
-				LegoTexture* discardTexture = new LegoTexture();
-				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
-					goto done;
-				}
-				delete discardTexture;
-			}
-			else {
-				LegoTexture* discardTexture = new LegoTexture();
-				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
-					goto done;
-				}
-				delete discardTexture;
-
-				texture = new LegoTexture();
-				if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-					goto done;
-				}
-			}
-		}
-		else {
-			texture = new LegoTexture();
-			if (texture->Read(&storage, hardwareMode) != SUCCESS) {
-				goto done;
-			}
-		}
-
-		if (TextureContainer()->Get(textureName) == NULL) {
-			textureInfo = LegoTextureInfo::Create(textureName, texture);
-
-			if (textureInfo == NULL) {
-				goto done;
-			}
-
-			TextureContainer()->Add(textureName, textureInfo);
-		}
-
-		delete[] textureName;
-		textureName = NULL;
-		delete texture;
-		texture = NULL;
+	if (p_textures->Store() != SUCCESS) {
+		goto done;
 	}
 
 	if (storage.SetPosition(4) != SUCCESS) {
@@ -226,21 +171,61 @@ MxResult LegoPartPresenter::Read(MxDSChunk& p_chunk)
 // FUNCTION: LEGO1 0x1007deb0
 void LegoPartPresenter::ReadyTickle()
 {
-	MxStreamChunk* chunk = m_subscriber->PeekData();
+	if (m_textureLoadJob == NULL) {
+		MxStreamChunk* chunk = m_subscriber->PeekData();
 
-	if (chunk != NULL && chunk->GetTime() <= m_action->GetElapsedTime()) {
-		ParseExtra();
-		ProgressTickleState(e_starting);
+		if (chunk == NULL || chunk->GetTime() > m_action->GetElapsedTime()) {
+			return;
+		}
 
-		chunk = m_subscriber->PopData();
-		MxResult result = Read(*chunk);
-		m_subscriber->FreeDataChunk(chunk);
+		// Decode the textures in the background; the presenter stays ready until they are done.
+		// The chunk stays at the head of the subscriber's queue until then, so a stop chunk
+		// cannot end the action underneath the job.
+		m_textureLoadJob = new LegoTextureLoadJob(
+			chunk->GetData(),
+			chunk->GetLength(),
+			LegoTextureLoadJob::e_part,
+			g_partPresenterConfig1,
+			VideoManager()->GetDirect3D()->AssignedDevice()->GetHardwareMode()
+		);
+		MxJobPool::Schedule(m_textureLoadJob);
+	}
 
-		if (result == SUCCESS) {
-			Store();
-		}
+	if (!m_textureLoadJob->IsDone()) {
+		return;
+	}
 
-		EndAction();
+	ParseExtra();
+	ProgressTickleState(e_starting);
+
+	m_currentChunk = m_subscriber->PopData();
+	MxResult result = Read(*m_currentChunk, m_textureLoadJob);
+
+	delete m_textureLoadJob;
+	m_textureLoadJob = NULL;
+	m_subscriber->FreeDataChunk(m_currentChunk);
+	m_currentChunk = NULL;
+
+	if (result == SUCCESS) {
+		Store();
+	}
+
+	EndAction();
+}
+
+void LegoPartPresenter::EndAction()
+{
+	// The subscriber frees the chunk a pending job reads from
+	CancelTextureLoad();
+	MxMediaPresenter::EndAction();
+}
+
+void LegoPartPresenter::CancelTextureLoad()
+{
+	if (m_textureLoadJob) {
+		MxJobPool::Cancel(m_textureLoadJob);
+		delete m_textureLoadJob;
+		m_textureLoadJob = NULL;
 	}
 }
 
@@ -0,0 +1,141 @@
+#include "legotextureloadjob.h"
+
+#include "legotextureinfo.h"
+#include "misc.h"
+#include "misc/legocontainer.h"
+#include "misc/legostorage.h"
+#include "misc/legotexture.h"
+
+#include <SDL3/SDL_stdinc.h>
+
+LegoTextureLoadJob::LegoTextureLoadJob(
+	void* p_data,
+	LegoU32 p_length,
+	Format p_format,
+	MxS32 p_firstVariant,
+	LegoS32 p_hardwareMode
+)
+	: m_data(p_data), m_length(p_length), m_format(p_format), m_firstVariant(p_firstVariant),
+	  m_hardwareMode(p_hardwareMode), m_result(FAILURE), m_skipTextures(0)
+{
+}
+
+LegoTextureLoadJob::~LegoTextureLoadJob()
+{
+	for (size_t i = 0; i < m_textures.size(); i++) {
+		delete[] m_textures[i].m_name;
+		delete m_textures[i].m_texture;
+	}
+}
+
+void LegoTextureLoadJob::Run()
+{
+	LegoMemory storage(m_data, m_length);
+	LegoU32 textureInfoOffset, i, numTextures;
+	LegoChar* textureName = NULL;
+	LegoTexture* texture = NULL;
+
+	if (m_format == e_model && storage.SetPosition(4) != SUCCESS) {
+		goto done;
+	}
+	if (storage.Read(&textureInfoOffset, sizeof(LegoU32)) != SUCCESS) {
+		goto done;
+	}
+	if (storage.SetPosition(textureInfoOffset) != SUCCESS) {
+		goto done;
+	}
+	if (storage.Read(&numTextures, sizeof(LegoU32)) != SUCCESS) {
+		goto done;
+	}
+	if (m_format == e_model && storage.Read(&m_skipTextures, sizeof(LegoU32)) != SUCCESS) {
+		goto done;
+	}
+
+	for (i = 0; i < numTextures; i++) {
+		LegoU32 textureNameLength;
+
+		storage.Read(&textureNameLength, sizeof(LegoU32));
+		textureName = new LegoChar[textureNameLength + 1];
+		storage.Read(textureName, textureNameLength);
+		textureName[textureNameLength] = '\0';
+
+		SDL_strlwr(textureName);
+
+		if (textureName[0] == '^') {
+			memmove(textureName, textureName + 1, strlen(textureName));
+
+			if (m_firstVariant) {
+				texture = new LegoTexture();
+				if (texture->Read(&storage, m_hardwareMode) != SUCCESS) {
+					goto done;
+				}
+
+				LegoTexture* discardTexture = new LegoTexture();
+				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
+					delete discardTexture;
+					goto done;
+				}
+				delete discardTexture;
+			}
+			else {
+				LegoTexture* discardTexture = new LegoTexture();
+				if (discardTexture->Read(&storage, FALSE) != SUCCESS) {
+					delete discardTexture;
+					goto done;
+				}
+				delete discardTexture;
+
+				texture = new LegoTexture();
+				if (texture->Read(&storage, m_hardwareMode) != SUCCESS) {
+					goto done;
+				}
+			}
+		}
+		else {
+			texture = new LegoTexture();
+			if (texture->Read(&storage, m_hardwareMode) != SUCCESS) {
+				goto done;
+			}
+		}
+
+		Texture entry = {textureName, texture};
+		m_textures.push_back(entry);
+		textureName = NULL;
+		texture = NULL;
+	}
+
+	m_result = SUCCESS;
+
+done:
+	if (textureName != NULL) {
+		delete[] textureName;
+	}
+	if (texture != NULL) {
+		delete texture;
+	}
+}
+
+MxResult LegoTextureLoadJob::Store()
+{
+	if (m_result != SUCCESS) {
+		return FAILURE;
+	}
+
+	if (m_skipTextures) {
+		return SUCCESS;
+	}
+
+	for (size_t i = 0; i < m_textures.size(); i++) {
+		if (TextureContainer()->Get(m_textures[i].m_name) == NULL) {
+			LegoTextureInfo* textureInfo = LegoTextureInfo::Create(m_textures[i].m_name, m_textures[i].m_texture);
+
+			if (textureInfo == NULL) {
+				return FAILURE;
+			}
+
+			TextureContainer()->Add(m_textures[i].m_name, textureInfo);
+		}
+	}
+
+	return SUCCESS;
+}
@@ -295,7 +295,7 @@ MxLong LegoAct2::Notify(MxParam& p_param)
 			break;
 		}
 		case c_notificationAct2Brick:
-			SoundManager()->GetCacheSoundManager()->Play("28bng", NULL, FALSE);
+			SoundManager()->GetCacheSoundManager()->PlayOneShot("28bng", NULL);
 
 			m_removedBricks++;
 			if (m_removedBricks == 10 && m_state == LegoAct2::e_brickHunt) {
@@ -7,7 +7,9 @@
 
 DECOMP_SIZE_ASSERT(LegoStorage, 0x08);
 DECOMP_SIZE_ASSERT(LegoMemory, 0x10);
-DECOMP_SIZE_ASSERT(LegoFile, 0x0c);
+DECOMP_SIZE_ASSERT(LegoFile, 0x18);
+
+#define FILE_BUFFER_SIZE 4096
 
 // FUNCTION: LEGO1 0x10099080
 LegoMemory::LegoMemory(void* p_buffer, LegoU32 p_size) : LegoStorage()
@@ -20,7 +22,11 @@ LegoMemory::LegoMemory(void* p_buffer, LegoU32 p_size) : LegoStorage()
 // FUNCTION: LEGO1 0x10099160
 LegoResult LegoMemory::Read(void* p_buffer, LegoU32 p_size)
 {
-	assert(m_position + p_size <= m_size);
+	// The position can only be past the end after an unchecked Write in a release build
+	if (m_position > m_size || p_size > m_size - m_position) {
+		return FAILURE;
+	}
+
 	memcpy(p_buffer, m_buffer + m_position, p_size);
 	m_position += p_size;
 	return SUCCESS;
@@ -39,6 +45,9 @@ LegoResult LegoMemory::Write(const void* p_buffer, LegoU32 p_size)
 LegoFile::LegoFile()
 {
 	m_file = NULL;
+	m_buffer = NULL;
+	m_bufferPosition = 0;
+	m_bufferSize = 0;
 }
 
 // FUNCTION: LEGO1 0x10099250
@@ -47,6 +56,7 @@ LegoFile::~LegoFile()
 	if (m_file) {
 		SDL_CloseIO(m_file);
 	}
+	delete[] m_buffer;
 }
 
 // FUNCTION: LEGO1 0x100992c0
@@ -55,12 +65,52 @@ LegoResult LegoFile::Read(void* p_buffer, LegoU32 p_size)
 	if (!m_file) {
 		return FAILURE;
 	}
-	if (SDL_ReadIO(m_file, p_buffer, p_size) != p_size) {
-		return FAILURE;
+
+	if (!m_buffer) {
+		if (SDL_ReadIO(m_file, p_buffer, p_size) != p_size) {
+			return FAILURE;
+		}
+		return SUCCESS;
 	}
+
+	LegoU8* dest = (LegoU8*) p_buffer;
+
+	while (p_size > 0) {
+		if (m_bufferPosition == m_bufferSize) {
+			// Large reads (e.g. vertex arrays) skip the buffer
+			if (p_size >= FILE_BUFFER_SIZE) {
+				if (SDL_ReadIO(m_file, dest, p_size) != p_size) {
+					return FAILURE;
+				}
+				return SUCCESS;
+			}
+
+			if (FillBuffer() != SUCCESS) {
+				return FAILURE;
+			}
+		}
+
+		LegoU32 length = m_bufferSize - m_bufferPosition;
+		if (length > p_size) {
+			length = p_size;
+		}
+
+		memcpy(dest, m_buffer + m_bufferPosition, length);
+		m_bufferPosition += length;
+		dest += length;
+		p_size -= length;
+	}
+
 	return SUCCESS;
 }
 
+LegoResult LegoFile::FillBuffer()
+{
+	m_bufferPosition = 0;
+	m_bufferSize = SDL_ReadIO(m_file, m_buffer, FILE_BUFFER_SIZE);
+	return m_bufferSize ? SUCCESS : FAILURE;
+}
+
 // FUNCTION: LEGO1 0x10099300
 LegoResult LegoFile::Write(const void* p_buffer, LegoU32 p_size)
 {
@@ -83,7 +133,8 @@ LegoResult LegoFile::GetPosition(LegoU32& p_position)
 	if (position == -1) {
 		return FAILURE;
 	}
-	p_position = position;
+	// The file is ahead of the caller by whatever is still buffered
+	p_position = position - (m_bufferSize - m_bufferPosition);
 	return SUCCESS;
 }
 
@@ -93,6 +144,7 @@ LegoResult LegoFile::SetPosition(LegoU32 p_position)
 	if (!m_file) {
 		return FAILURE;
 	}
+	m_bufferPosition = m_bufferSize = 0;
 	if (SDL_SeekIO(m_file, p_position, SDL_IO_SEEK_SET) != p_position) {
 		return FAILURE;
 	}
@@ -105,6 +157,9 @@ LegoResult LegoFile::Open(const char* p_name, LegoU32 p_mode)
 	if (m_file) {
 		SDL_CloseIO(m_file);
 	}
+	delete[] m_buffer;
+	m_buffer = NULL;
+	m_bufferPosition = m_bufferSize = 0;
 	char mode[4];
 	mode[0] = '\0';
 	if (p_mode & c_read) {
@@ -129,5 +184,8 @@ LegoResult LegoFile::Open(const char* p_name, LegoU32 p_mode)
 	if (!(m_file = SDL_IOFromFile(path.GetData(), mode))) {
 		return FAILURE;
 	}
+	if (m_mode == c_read && !(p_mode & c_write)) {
+		m_buffer = new LegoU8[FILE_BUFFER_SIZE];
+	}
 	return SUCCESS;
 }
@@ -207,7 +207,10 @@ class LegoMemory : public LegoStorage {
 	// FUNCTION: LEGO1 0x100994b0
 	LegoResult SetPosition(LegoU32 p_position) override // vtable+0x10
 	{
-		assert(p_position <= m_size);
+		if (p_position > m_size) {
+			return FAILURE;
+		}
+
 		m_position = p_position;
 		return SUCCESS;
 	}
@@ -225,7 +228,7 @@ class LegoMemory : public LegoStorage {
 };
 
 // VTABLE: LEGO1 0x100db730
-// SIZE 0x0c
+// SIZE 0x18
 class LegoFile : public LegoStorage {
 public:
 	LegoFile();
@@ -241,7 +244,15 @@ class LegoFile : public LegoStorage {
 	// LegoFile::`scalar deleting destructor'
 
 protected:
+	LegoResult FillBuffer();
+
 	SDL_IOStream* m_file; // 0x08
+
+	// Read-ahead for files opened for reading only. Most reads are single fields of a few bytes,
+	// so they are served from here instead of going through SDL_ReadIO one by one.
+	LegoU8* m_buffer;         // 0x0c
+	LegoU32 m_bufferPosition; // 0x10
+	LegoU32 m_bufferSize;     // 0x14
 };
 
 #endif // __LEGOSTORAGE_H
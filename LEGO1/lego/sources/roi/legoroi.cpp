@@ -615,6 +615,71 @@ LegoResult LegoROI::SetColorByName(const LegoChar* p_name)
 	return 0;
 }
 
+// Cheap rejection for the oriented box test in Intersect: FALSE if the segment stays outside the sphere
+// around the transformed bounding box. Path actors run this against every actor on nearby boundaries each step.
+LegoBool LegoROI::SegmentMayHitBox(
+	const Vector3& p_rayOrigin,
+	const Vector3& p_rayDirection,
+	float p_rayLength
+) const
+{
+	const Vector3& min = m_bounding_box.Min();
+	const Vector3& max = m_bounding_box.Max();
+	float center[3], offset[3];
+	float halfDiagonalSquared = 0.0f;
+	float scaleSquared = 0.0f;
+	LegoS32 i;
+
+	for (i = 0; i < 3; i++) {
+		float half = (max[i] - min[i]) * 0.5f;
+		halfDiagonalSquared += half * half;
+	}
+
+	for (i = 0; i < 3; i++) {
+		center[i] = m_local2world[3][i];
+		for (LegoS32 j = 0; j < 3; j++) {
+			center[i] += (min[j] + max[j]) * 0.5f * m_local2world[j][i];
+		}
+
+		float rowSquared =
+			m_local2world[i][0] * m_local2world[i][0] + m_local2world[i][1] * m_local2world[i][1] +
+			m_local2world[i][2] * m_local2world[i][2];
+		if (rowSquared > scaleSquared) {
+			scaleSquared = rowSquared;
+		}
+	}
+
+	float dirSquared = 0.0f;
+	float t = 0.0f;
+
+	for (i = 0; i < 3; i++) {
+		offset[i] = center[i] - p_rayOrigin[i];
+		t += offset[i] * p_rayDirection[i];
+		dirSquared += p_rayDirection[i] * p_rayDirection[i];
+	}
+
+	// Closest point to the center on the segment from the origin to origin + direction * length
+	if (dirSquared > 0.0f) {
+		t /= dirSquared;
+	}
+
+	if (t < 0.0f) {
+		t = 0.0f;
+	}
+	else if (t > p_rayLength) {
+		t = p_rayLength;
+	}
+
+	float distanceSquared = 0.0f;
+	for (i = 0; i < 3; i++) {
+		float d = offset[i] - p_rayDirection[i] * t;
+		distanceSquared += d * d;
+	}
+
+	// Small margin so the original test's own tolerances never reject less than this does
+	return distanceSquared <= halfDiagonalSquared * scaleSquared * 1.01f + 0.01f;
+}
+
 // FUNCTION: LEGO1 0x100a9410
 // FUNCTION: BETA10 0x1018b324
 LegoU32 LegoROI::Intersect(
@@ -627,6 +692,10 @@ LegoU32 LegoROI::Intersect(
 )
 {
 	if (p_collideBox) {
+		if (!SegmentMayHitBox(p_rayOrigin, p_rayDirection, p_rayLength)) {
+			return 0;
+		}
+
 		Mx3DPointFloat v2(p_rayDirection);
 		v2 *= p_rayLength;
 		v2 += p_rayOrigin;
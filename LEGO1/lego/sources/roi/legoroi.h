@@ -116,6 +116,8 @@ class LegoROI : public ViewROI {
 	// LegoROI::`scalar deleting destructor'
 
 private:
+	LegoBool SegmentMayHitBox(const Vector3& p_rayOrigin, const Vector3& p_rayDirection, float p_rayLength) const;
+
 	LegoChar* m_name;         // 0xe4
 	BoundingSphere m_sphere;  // 0xe8
 	LegoBool m_sharedLodList; // 0x100
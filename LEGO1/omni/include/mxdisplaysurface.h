@@ -104,6 +104,9 @@ class MxDisplaySurface : public MxCore {
 
 	void Init();
 
+	LPDIRECTDRAWSURFACE GetStagingSurface(MxS32 p_width, MxS32 p_height, MxBool p_transparent);
+	void ReleaseStagingSurfaces();
+
 	MxVideoParam m_videoParam;        // 0x08
 	LPDIRECTDRAWSURFACE m_ddSurface1; // 0x2c
 	LPDIRECTDRAWSURFACE m_ddSurface2; // 0x30
@@ -112,6 +115,20 @@ class MxDisplaySurface : public MxCore {
 	DDSURFACEDESC m_surfaceDesc;      // 0x3c
 	MxU16* m_16bitPal;                // 0xa8
 	MxU32* m_32bitPal;
+
+	// Offscreen surfaces VTable0x28 and VTable0x30 copy bitmaps through, kept by size so presenting
+	// a video or still frame does not create and destroy a surface (and its texture) every time.
+	// The two functions do not share surfaces because they set different color keys.
+	struct StagingSurface {
+		LPDIRECTDRAWSURFACE m_surface;
+		MxS32 m_width;
+		MxS32 m_height;
+		MxBool m_transparent; // Used by VTable0x30, which always keys out index 0
+		MxU32 m_lastUse;
+	};
+
+	StagingSurface m_stagingSurfaces[4];
+	MxU32 m_stagingUseCount;
 };
 
 // SYNTHETIC: LEGO1 0x100ba580
@@ -39,11 +39,18 @@ class MxFlcPresenter : public MxVideoPresenter {
 	void LoadFrame(MxStreamChunk* p_chunk) override;  // vtable+0x68
 	void RealizePalette() override;                   // vtable+0x70
 
+	MxBool SupportsBackgroundDecode() override { return TRUE; }
+	void DecodeFrame(MxVideoDecodeQueue::Frame& p_frame) override;
+
 	// SYNTHETIC: LEGO1 0x100b3400
 	// MxFlcPresenter::`scalar deleting destructor'
 
 protected:
 	FLIC_HEADER* m_flcHeader; // 0x64
+
+	// FLC frames are deltas, so background decoding works on a persistent bitmap owned by the worker
+	// and copies the result into the ring frame.
+	MxBitmap* m_decodeBitmap;
 };
 
 #endif // MXFLCPRESENTER_H
@@ -0,0 +1,73 @@
+#ifndef MXJOBPOOL_H
+#define MXJOBPOOL_H
+
+#include "mxcriticalsection.h"
+#include "mxsemaphore.h"
+#include "mxthread.h"
+#include "mxtypes.h"
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+class MxJobPool;
+
+// Unit of background work, e.g. decoding the assets of a presenter's chunk. Run() is called on a pool
+// worker; the owner polls IsDone() from its tickle and picks up the results once it returns TRUE.
+class MxJob {
+public:
+	MxJob() : m_done(FALSE) {}
+	virtual ~MxJob() {}
+
+	virtual void Run() = 0;
+
+	MxBool IsDone() const { return m_done.load(std::memory_order_acquire); }
+
+private:
+	friend class MxJobPool;
+
+	std::atomic<MxBool> m_done;
+};
+
+class MxJobThread : public MxThread {
+public:
+	MxJobThread(MxJobPool* p_pool) : m_pool(p_pool) {}
+
+	MxResult Run() override;
+
+private:
+	MxJobPool* m_pool;
+};
+
+// Small worker pool for asset loading jobs. Workers are started on first use and stopped by Shutdown()
+// in MxOmni::Destroy once the presenters have been torn down.
+class MxJobPool {
+public:
+	// Queues p_job for a worker. Without workers (e.g. on a single core machine) the job is run
+	// inline, so it is always done or on its way once this returns.
+	static void Schedule(MxJob* p_job);
+
+	// Removes p_job from the queue, or waits for it if a worker already picked it up
+	static void Cancel(MxJob* p_job);
+
+	static void Shutdown();
+
+private:
+	friend class MxJobThread;
+
+	MxJobPool();
+	~MxJobPool();
+
+	static MxBool IsAvailable();
+
+	MxResult Create(MxS32 p_numThreads);
+	MxBool RunJob();
+
+	MxCriticalSection m_criticalSection;
+	MxSemaphore m_jobSemaphore;
+	std::deque<MxJob*> m_jobs;
+	std::vector<MxJobThread*> m_threads;
+	std::atomic<MxBool> m_shutdown;
+};
+
+#endif // MXJOBPOOL_H
@@ -5,6 +5,7 @@
 #include "mxcore.h"
 #include "mxtypes.h"
 
+#include <new>
 #include <type_traits>
 
 template <class T>
@@ -43,6 +44,82 @@ class MxListEntry {
 	MxListEntry* m_next;
 };
 
+// Link stored in place of an entry while it is in an entry pool
+struct MxListFreeEntry {
+	MxListFreeEntry* m_next;
+};
+
+// Recycles list entries, so adding and removing elements of the lists walked every frame (presenters,
+// entities, actions, stream chunks) does not go through the heap each time. Each thread keeps up to
+// g_maxFreeEntries entries per entry type; entries released past that are returned to the heap.
+template <class T>
+class MxListEntryPool {
+public:
+	~MxListEntryPool()
+	{
+		g_destroyed = TRUE;
+
+		MxListFreeEntry* next;
+		for (MxListFreeEntry* entry = m_free; entry; entry = next) {
+			next = entry->m_next;
+			::operator delete(entry);
+		}
+	}
+
+	static void* Allocate()
+	{
+		// Lists destroyed after this thread's pool, e.g. static ones at exit, use the heap directly
+		if (!g_destroyed) {
+			MxListEntryPool& pool = g_pool;
+
+			if (pool.m_free) {
+				MxListFreeEntry* entry = pool.m_free;
+				pool.m_free = entry->m_next;
+				pool.m_numFree--;
+				return entry;
+			}
+		}
+
+		return ::operator new(sizeof(MxListEntry<T>));
+	}
+
+	static void Release(MxListEntry<T>* p_entry)
+	{
+		p_entry->~MxListEntry<T>();
+
+		if (!g_destroyed) {
+			MxListEntryPool& pool = g_pool;
+
+			if (pool.m_numFree < g_maxFreeEntries) {
+				MxListFreeEntry* entry = new (p_entry) MxListFreeEntry;
+				entry->m_next = pool.m_free;
+				pool.m_free = entry;
+				pool.m_numFree++;
+				return;
+			}
+		}
+
+		::operator delete(p_entry);
+	}
+
+private:
+	MxListEntryPool() : m_free(NULL), m_numFree(0) {}
+
+	static const MxU32 g_maxFreeEntries = 64;
+
+	static thread_local MxListEntryPool<T> g_pool;
+	static thread_local MxBool g_destroyed;
+
+	MxListFreeEntry* m_free;
+	MxU32 m_numFree;
+};
+
+template <class T>
+thread_local MxListEntryPool<T> MxListEntryPool<T>::g_pool;
+
+template <class T>
+thread_local MxBool MxListEntryPool<T>::g_destroyed = FALSE;
+
 // SIZE 0x18
 template <class T>
 class MxList : protected MxCollection<T> {
@@ -144,7 +221,7 @@ inline void MxList<T>::DeleteAll()
 	for (MxListEntry<T>* t = m_first; t; t = next) {
 		next = t->GetNext();
 		this->m_customDestructor(t->GetValue());
-		delete t;
+		MxListEntryPool<T>::Release(t);
 	}
 
 	this->m_count = 0;
@@ -158,7 +235,7 @@ inline void MxList<T>::Empty()
 	MxListEntry<T>* next;
 	for (MxListEntry<T>* t = m_first; t; t = next) {
 		next = t->GetNext();
-		delete t;
+		MxListEntryPool<T>::Release(t);
 	}
 
 	this->m_count = 0;
@@ -168,7 +245,7 @@ inline void MxList<T>::Empty()
 template <class T>
 inline MxListEntry<T>* MxList<T>::InsertEntry(T p_newobj, MxListEntry<T>* p_prev, MxListEntry<T>* p_next)
 {
-	MxListEntry<T>* newEntry = new MxListEntry<T>(p_newobj, p_prev, p_next);
+	MxListEntry<T>* newEntry = new (MxListEntryPool<T>::Allocate()) MxListEntry<T>(p_newobj, p_prev, p_next);
 
 	if (p_prev) {
 		p_prev->SetNext(newEntry);
@@ -205,7 +282,7 @@ inline void MxList<T>::DeleteEntry(MxListEntry<T>* p_match)
 		m_last = p_match->GetPrev();
 	}
 
-	delete p_match;
+	MxListEntryPool<T>::Release(p_match);
 	this->m_count--;
 }
 
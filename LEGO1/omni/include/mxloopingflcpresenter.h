@@ -31,6 +31,9 @@ class MxLoopingFlcPresenter : public MxFlcPresenter {
 	void NextFrame() override;          // vtable+0x64
 	virtual void LoadFrameIfRequired(); // vtable+0x88
 
+	// Frames are replayed through LoadFrameIfRequired() on the tickle thread
+	MxBool SupportsBackgroundDecode() override { return FALSE; }
+
 	// SYNTHETIC: LEGO1 0x100b4390
 	// MxLoopingFlcPresenter::`scalar deleting destructor'
 
@@ -32,6 +32,9 @@ class MxLoopingSmkPresenter : public MxSmkPresenter {
 	void ResetCurrentFrameAtEnd() override; // vtable+0x88
 	virtual void LoadFrameIfRequired();     // vtable+0x8c
 
+	// Frames are replayed through LoadFrameIfRequired() on the tickle thread
+	MxBool SupportsBackgroundDecode() override { return FALSE; }
+
 private:
 	void Init();
 	void Destroy(MxBool p_fromDestructor);
@@ -41,9 +41,11 @@ class MxOmni : public MxCore {
 	static const char* GetHD();
 	static MxOmni* GetInstance();
 	static MxBool IsSound3D();
+	static MxBool IsLowLatencyAudio();
 	LEGO1_EXPORT static void SetCD(const char* p_cd);
 	LEGO1_EXPORT static void SetHD(const char* p_hd);
 	LEGO1_EXPORT static void SetSound3D(MxBool p_use3dSound);
+	LEGO1_EXPORT static void SetLowLatencyAudio(MxBool p_lowLatencyAudio);
 	static vector<MxString>& GetHDFiles() { return g_hdFiles; }
 	static vector<MxString>& GetCDFiles() { return g_cdFiles; }
 
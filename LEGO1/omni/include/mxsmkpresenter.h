@@ -40,6 +40,9 @@ class MxSmkPresenter : public MxVideoPresenter {
 	void RealizePalette() override;                   // vtable+0x70
 	virtual void ResetCurrentFrameAtEnd();            // vtable+0x88
 
+	MxBool SupportsBackgroundDecode() override { return TRUE; }
+	void DecodeFrame(MxVideoDecodeQueue::Frame& p_frame) override;
+
 	// SYNTHETIC: LEGO1 0x100b3850
 	// MxSmkPresenter::`scalar deleting destructor'
 
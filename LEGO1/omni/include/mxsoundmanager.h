@@ -7,6 +7,7 @@
 #include "mxminiaudio.h"
 
 #include <SDL3/SDL_audio.h>
+#include <atomic>
 
 // VTABLE: LEGO1 0x100dc128
 // VTABLE: BETA10 0x101c1ce8
@@ -16,6 +17,7 @@ class MxSoundManager : public MxAudioManager {
 	MxSoundManager();
 	~MxSoundManager() override; // vtable+0x00
 
+	MxResult Tickle() override;                                          // vtable+0x08
 	void Destroy() override;                                             // vtable+0x18
 	void SetVolume(MxS32 p_volume) override;                             // vtable+0x2c
 	virtual MxResult Create(MxU32 p_frequencyMS, MxBool p_createThread); // vtable+0x30
@@ -28,6 +30,11 @@ class MxSoundManager : public MxAudioManager {
 
 	MxPresenter* FindPresenter(const MxAtomId& p_atomId, MxU32 p_objectId);
 
+	// Longest recent gap between two tickles, used to size streaming buffers in low latency mode
+	MxU32 GetPeakTickleGap() const { return (MxU32) m_peakTickleGap.load(std::memory_order_relaxed); }
+
+	void CountUnderrun() { m_underruns++; }
+
 	// SYNTHETIC: LEGO1 0x100ae7b0
 	// SYNTHETIC: BETA10 0x10133460
 	// MxSoundManager::`scalar deleting destructor'
@@ -41,6 +48,13 @@ class MxSoundManager : public MxAudioManager {
 	// Not sure how DirectSound handles this when different buffers have different rates.
 	static const MxU32 g_sampleRate = 44100;
 
+	// Frames mixed per pass of the audio callback. Larger device requests are mixed in several passes,
+	// so the callback never allocates.
+	static const MxU32 g_mixBufferFrames = 1024;
+
+	// Device buffer requested in low latency mode (~6 ms at 44.1KHz), instead of SDL's default
+	static const MxU32 g_lowLatencyDeviceFrames = 256;
+
 	static void AudioStreamCallback(
 		void* p_userdata,
 		SDL_AudioStream* p_stream,
@@ -51,6 +65,13 @@ class MxSoundManager : public MxAudioManager {
 	MxMiniaudio<ma_engine> m_engine;
 	SDL_AudioStream* m_stream;
 	undefined m_unk0x38[4];
+
+	float* m_mixBuffer;
+	MxU64 m_lastTickleTime;
+	// Written by the tickle thread, read when presenters size their buffers
+	std::atomic<float> m_peakTickleGap;
+	MxU32 m_underruns; // Streaming sounds whose buffer ran dry while more data was pending
+	MxU32 m_overruns;  // Callbacks that took longer to mix than the audio they produced, audio thread only
 };
 
 #endif // MXSOUNDMANAGER_H
@@ -0,0 +1,83 @@
+#ifndef MXSPSCQUEUE_H
+#define MXSPSCQUEUE_H
+
+#include "mxtypes.h"
+
+#include <assert.h>
+#include <atomic>
+#include <stddef.h>
+#include <vector>
+
+// Bounded, lock-free single-producer/single-consumer ring buffer.
+// Slots are constructed once up front and reused in place, so element types that own
+// storage (e.g. std::vector) keep their capacity and steady-state traffic does not allocate.
+// Exactly one thread may call the producer functions and one thread the consumer functions.
+template <typename T>
+class MxSpscQueue {
+public:
+	MxSpscQueue(size_t p_capacity) : m_head(0), m_tail(0)
+	{
+		size_t capacity = 1;
+		while (capacity < p_capacity) {
+			capacity <<= 1;
+		}
+
+		m_slots.resize(capacity);
+		m_mask = capacity - 1;
+	}
+
+	// Producer: returns the next free slot, or NULL if the queue is full.
+	// The slot becomes visible to the consumer after CommitWrite().
+	T* BeginWrite()
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail - m_head.load(std::memory_order_acquire) > m_mask) {
+			return NULL;
+		}
+
+		return &m_slots[tail & m_mask];
+	}
+
+	void CommitWrite() { m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+	// Consumer: returns the p_index-th pending element (0 = oldest), or NULL.
+	T* Peek(size_t p_index = 0)
+	{
+		size_t head = m_head.load(std::memory_order_relaxed);
+		if (m_tail.load(std::memory_order_acquire) - head <= p_index) {
+			return NULL;
+		}
+
+		return &m_slots[(head + p_index) & m_mask];
+	}
+
+	void Pop()
+	{
+		size_t head = m_head.load(std::memory_order_relaxed);
+		assert(m_tail.load(std::memory_order_acquire) != head);
+		m_head.store(head + 1, std::memory_order_release);
+	}
+
+	size_t Size() const
+	{
+		// Load head first: tail never falls behind it, so the difference cannot underflow.
+		size_t head = m_head.load(std::memory_order_acquire);
+		return m_tail.load(std::memory_order_acquire) - head;
+	}
+
+	size_t Capacity() const { return m_mask + 1; }
+	MxBool IsEmpty() const { return Size() == 0; }
+
+	// Only safe while neither side is active.
+	void Clear() { m_head.store(m_tail.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+private:
+	std::vector<T> m_slots;
+	size_t m_mask;
+
+	// Keep the indices on separate cache lines to avoid false sharing between the two threads.
+	alignas(64) std::atomic<size_t> m_head; // written by consumer
+	alignas(64) std::atomic<size_t> m_tail; // written by producer
+};
+
+#endif // MXSPSCQUEUE_H
@@ -0,0 +1,114 @@
+#ifndef MXVIDEODECODER_H
+#define MXVIDEODECODER_H
+
+#include "mxcriticalsection.h"
+#include "mxgeometry.h"
+#include "mxsemaphore.h"
+#include "mxthread.h"
+#include "mxtypes.h"
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+class MxBitmap;
+class MxStreamChunk;
+class MxVideoDecodePool;
+class MxVideoPresenter;
+
+// Ring of frames that a video presenter has handed to the decode pool ahead of their presentation time.
+// Submit(), Front(), Pop() and the statistics are only called from the presenter's tickle thread;
+// Decode() runs on a pool worker. Frames of one stream are always decoded in order by at most one worker,
+// since both SMK and FLC frames are deltas against the previous one.
+class MxVideoDecodeQueue {
+public:
+	enum {
+		c_numFrames = 4
+	};
+
+	struct Frame {
+		MxStreamChunk* m_chunk;
+		MxBitmap* m_bitmap;
+		std::vector<MxRect32> m_rects; // Bitmap-relative areas changed by this frame
+		MxBool m_paletteChanged;
+		std::atomic<MxBool> m_decoded;
+	};
+
+	// Returns NULL when background decoding is unavailable, in which case the presenter decodes synchronously.
+	static MxVideoDecodeQueue* Create(MxVideoPresenter* p_presenter, MxBitmap* p_frameBitmap);
+
+	~MxVideoDecodeQueue();
+
+	MxBool IsFull() const { return m_tail - m_head == c_numFrames; }
+	MxBool IsEmpty() const { return m_tail == m_head; }
+
+	void Submit(MxStreamChunk* p_chunk);
+	Frame* Front() { return IsEmpty() ? NULL : &m_frames[m_head % c_numFrames]; }
+	MxBool IsDecoded(Frame* p_frame) const { return p_frame->m_decoded.load(std::memory_order_acquire); }
+	void Pop();
+
+	// Stops decoding and waits for an in-flight frame. Submitted chunks stay queued for the caller to free.
+	void Cancel();
+
+	void CountLate(Frame* p_frame);
+	void CountPresented(MxU32 p_count);
+
+private:
+	friend class MxVideoDecodePool;
+
+	MxVideoDecodeQueue(MxVideoPresenter* p_presenter);
+
+	void Decode();
+
+	MxVideoPresenter* m_presenter;
+	Frame m_frames[c_numFrames];
+	MxU32 m_head;                       // Next frame to present, tickle thread only
+	MxU32 m_tail;                       // Next free slot, tickle thread only
+	MxU32 m_decodeIndex;                // Next frame to decode, worker only
+	std::atomic<MxU32> m_submitted;     // Published copy of m_tail
+	std::atomic<MxBool> m_scheduled;    // Queued in or being run by the pool
+	std::atomic<MxS32> m_activeWorkers; // Workers inside Decode(); briefly two while a claim is handed over
+	std::atomic<MxBool> m_cancelled;
+	const Frame* m_lastLateFrame;
+
+	MxU32 m_framesPresented;
+	MxU32 m_framesLate;    // Frames that were due before they had finished decoding
+	MxU32 m_framesDropped; // Decoded frames superseded by a newer due frame within the same tickle
+};
+
+class MxVideoDecodeThread : public MxThread {
+public:
+	MxVideoDecodeThread(MxVideoDecodePool* p_pool) : m_pool(p_pool) {}
+
+	MxResult Run() override;
+
+private:
+	MxVideoDecodePool* m_pool;
+};
+
+// Small worker pool shared by all video presenters. Workers are started on first use and stopped by
+// Shutdown() in MxOmni::Destroy once the presenters have been torn down.
+class MxVideoDecodePool {
+public:
+	static MxBool IsAvailable();
+	static void Schedule(MxVideoDecodeQueue* p_queue);
+	static void Cancel(MxVideoDecodeQueue* p_queue);
+	static void Shutdown();
+
+private:
+	friend class MxVideoDecodeThread;
+
+	MxVideoDecodePool();
+	~MxVideoDecodePool();
+
+	MxResult Create(MxS32 p_numThreads);
+	MxBool RunJob();
+
+	MxCriticalSection m_criticalSection;
+	MxSemaphore m_jobSemaphore;
+	std::deque<MxVideoDecodeQueue*> m_jobs;
+	std::vector<MxVideoDecodeThread*> m_threads;
+	std::atomic<MxBool> m_shutdown;
+};
+
+#endif // MXVIDEODECODER_H
@@ -5,6 +5,7 @@
 #include "mxbitmap.h"
 #include "mxgeometry.h"
 #include "mxmediapresenter.h"
+#include "mxvideodecoder.h"
 
 #ifdef MINIWIN
 #include "miniwin/ddraw.h"
@@ -60,6 +61,11 @@ class MxVideoPresenter : public MxMediaPresenter {
 		return m_alpha ? m_alpha->GetHeight() : m_frameBitmap->GetBmiHeightAbs();
 	} // vtable+0x84
 
+	// Presenters that opt in have their frames decoded ahead of time by MxVideoDecodePool.
+	// DecodeFrame() then runs on a worker thread and may only touch decoder state and p_frame.
+	virtual MxBool SupportsBackgroundDecode() { return FALSE; }
+	virtual void DecodeFrame(MxVideoDecodeQueue::Frame& p_frame) {}
+
 	// FUNCTION: BETA10 0x100551b0
 	static const char* HandlerClassName()
 	{
@@ -139,6 +145,9 @@ class MxVideoPresenter : public MxMediaPresenter {
 
 protected:
 	void Destroy(MxBool p_fromDestructor);
+	void StartBackgroundDecode();
+	void StopBackgroundDecode();
+	void BackgroundStreamingTickle();
 
 	MxBitmap* m_frameBitmap;       // 0x50
 	AlphaMask* m_alpha;            // 0x54
@@ -146,6 +155,8 @@ class MxVideoPresenter : public MxMediaPresenter {
 	MxS16 m_frameLoadTickleCount;  // 0x5c
 	FlagBitfield m_flags;          // 0x5e
 	MxLong m_frozenTime;           // 0x60
+
+	MxVideoDecodeQueue* m_decodeQueue;
 };
 
 #endif // MXVIDEOPRESENTER_H
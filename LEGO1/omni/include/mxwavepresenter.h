@@ -5,6 +5,8 @@
 #include "mxminiaudio.h"
 #include "mxsoundpresenter.h"
 
+#include <atomic>
+
 // VTABLE: LEGO1 0x100d49a8
 // SIZE 0x6c
 class MxWavePresenter : public MxSoundPresenter {
@@ -69,6 +71,9 @@ class MxWavePresenter : public MxSoundPresenter {
 	};
 #pragma pack(pop)
 
+	// Most PCM held at once in loop buffers and streaming rings across all wave presenters
+	static MxU32 GetPeakResidentBytes() { return g_peakResidentBytes.load(std::memory_order_relaxed); }
+
 	// SYNTHETIC: LEGO1 0x1000d810
 	// MxWavePresenter::`scalar deleting destructor'
 
@@ -76,6 +81,8 @@ class MxWavePresenter : public MxSoundPresenter {
 	void Init();
 	void Destroy(MxBool p_fromDestructor);
 	MxBool WriteToSoundBuffer(void* p_audioPtr, MxU32 p_length);
+	MxU32 GetRbSizeInMilliseconds();
+	void SetResidentBytes(MxU32 p_bytes);
 
 	// [library:audio] One chunk has up to 1 second worth of frames
 	static const MxU32 g_millisecondsPerChunk = 1000;
@@ -83,9 +90,16 @@ class MxWavePresenter : public MxSoundPresenter {
 	// [library:audio] Store up to 2 chunks worth of frames (same as in original game)
 	static const MxU32 g_rbSizeInMilliseconds = g_millisecondsPerChunk * 2;
 
+	// In low latency mode the ring only covers a few of the longest recent tickle gaps, within these bounds
+	static const MxU32 g_minLowLatencyRbSizeInMilliseconds = 100;
+	static const MxU32 g_lowLatencyRbTickleGaps = 4;
+
 	// [library:audio] WAVE_FORMAT_PCM (audio in .SI files only used this format)
 	static const MxU32 g_supportedFormatTag = 1;
 
+	static std::atomic<MxU32> g_residentBytes;
+	static std::atomic<MxU32> g_peakResidentBytes;
+
 	WaveFormat* m_waveFormat; // 0x54
 
 	// [library:audio]
@@ -105,6 +119,11 @@ class MxWavePresenter : public MxSoundPresenter {
 	MxBool m_is3d;       // 0x66
 	MxS8 m_silenceData;  // 0x67
 	MxBool m_paused;     // 0x68
+
+	MxU32 m_chunkOffset;   // Bytes of the current (silence padded) chunk already in the ring
+	MxU32 m_underruns;     // Times the ring ran dry while streaming
+	MxU32 m_residentBytes; // PCM held by this presenter's loop buffer or ring
+	MxBool m_drained;
 };
 
 #endif // MXWAVEPRESENTER_H
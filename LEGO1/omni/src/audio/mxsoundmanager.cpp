@@ -9,7 +9,9 @@
 #include "mxticklethread.h"
 #include "mxwavepresenter.h"
 
+#include <SDL3/SDL_hints.h>
 #include <SDL3/SDL_log.h>
+#include <SDL3/SDL_timer.h>
 
 DECOMP_SIZE_ASSERT(MxSoundManager, 0x3c);
 
@@ -44,6 +46,11 @@ void MxSoundManager::Init()
 {
 	SDL_zero(m_engine);
 	m_stream = NULL;
+	m_mixBuffer = NULL;
+	m_lastTickleTime = 0;
+	m_peakTickleGap.store(0.0f, std::memory_order_relaxed);
+	m_underruns = 0;
+	m_overruns = 0;
 }
 
 // FUNCTION: LEGO1 0x100ae840
@@ -64,7 +71,23 @@ void MxSoundManager::Destroy(MxBool p_fromDestructor)
 		SDL_DestroyAudioStream(m_stream);
 	}
 
+	if (m_underruns || m_overruns) {
+		SDL_LogDebug(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"Audio: %u stream underruns, %u mixer overruns",
+			m_underruns,
+			m_overruns
+		);
+	}
+
+	SDL_LogDebug(
+		SDL_LOG_CATEGORY_APPLICATION,
+		"Audio: peak of %u KB PCM held by wave presenters",
+		MxWavePresenter::GetPeakResidentBytes() / 1024
+	);
+
 	m_engine.Destroy(ma_engine_uninit);
+	delete[] m_mixBuffer;
 
 	Init();
 	m_criticalSection.Leave();
@@ -98,12 +121,20 @@ MxResult MxSoundManager::Create(MxU32 p_frequencyMS, MxBool p_createThread)
 		goto done;
 	}
 
+	m_mixBuffer = new float[g_mixBufferFrames * ma_engine_get_channels(m_engine)];
+
 	SDL_AudioSpec spec;
 	SDL_zero(spec);
 	spec.freq = ma_engine_get_sample_rate(m_engine);
 	spec.format = SDL_AUDIO_F32;
 	spec.channels = ma_engine_get_channels(m_engine);
 
+	if (MxOmni::IsLowLatencyAudio()) {
+		char frames[16];
+		SDL_snprintf(frames, sizeof(frames), "%u", g_lowLatencyDeviceFrames);
+		SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, frames);
+	}
+
 	if ((m_stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, &AudioStreamCallback, this)) !=
 		NULL) {
 		SDL_ResumeAudioDevice(SDL_GetAudioStreamDevice(m_stream));
@@ -147,19 +178,44 @@ void MxSoundManager::AudioStreamCallback(
 	int p_totalAmount
 )
 {
-	static vector<MxU8> g_buffer;
-	if (p_additionalAmount > g_buffer.size()) {
-		g_buffer.resize(p_additionalAmount);
-	}
-
 	MxSoundManager* manager = (MxSoundManager*) p_userdata;
+	ma_uint32 sampleRate = ma_engine_get_sample_rate(manager->m_engine);
 	ma_uint32 bytesPerFrame = ma_get_bytes_per_frame(ma_format_f32, ma_engine_get_channels(manager->m_engine));
-	ma_uint32 bufferSizeInFrames = (ma_uint32) p_additionalAmount / bytesPerFrame;
-	ma_uint64 framesRead;
+	ma_uint32 remainingFrames = (ma_uint32) p_additionalAmount / bytesPerFrame;
+	ma_uint32 requestedFrames = remainingFrames;
+	Uint64 start = SDL_GetTicksNS();
+
+	while (remainingFrames > 0) {
+		ma_uint32 frames = remainingFrames < g_mixBufferFrames ? remainingFrames : g_mixBufferFrames;
+		ma_uint64 framesRead;
 
-	if (ma_engine_read_pcm_frames(manager->m_engine, g_buffer.data(), bufferSizeInFrames, &framesRead) == MA_SUCCESS) {
-		SDL_PutAudioStreamData(manager->m_stream, g_buffer.data(), framesRead * bytesPerFrame);
+		if (ma_engine_read_pcm_frames(manager->m_engine, manager->m_mixBuffer, frames, &framesRead) != MA_SUCCESS ||
+			framesRead == 0) {
+			break;
+		}
+
+		SDL_PutAudioStreamData(manager->m_stream, manager->m_mixBuffer, (int) (framesRead * bytesPerFrame));
+		remainingFrames -= (ma_uint32) framesRead;
+	}
+
+	if (SDL_GetTicksNS() - start > (Uint64) requestedFrames * SDL_NS_PER_SECOND / sampleRate) {
+		manager->m_overruns++;
+	}
+}
+
+// Tracks the longest recent gap between tickles. The peak decays slowly, so a hitch is remembered for a few seconds.
+MxResult MxSoundManager::Tickle()
+{
+	MxU64 now = SDL_GetTicks();
+
+	if (m_lastTickleTime) {
+		float gap = (float) (now - m_lastTickleTime);
+		float peak = m_peakTickleGap.load(std::memory_order_relaxed) * 0.999f;
+		m_peakTickleGap.store(gap > peak ? gap : peak, std::memory_order_relaxed);
 	}
+
+	m_lastTickleTime = now;
+	return MxAudioManager::Tickle();
 }
 
 // FUNCTION: LEGO1 0x100aeab0
@@ -10,12 +10,16 @@
 #include "mxsoundmanager.h"
 #include "mxutilities.h"
 
+#include <SDL3/SDL_log.h>
 #include <SDL3/SDL_stdinc.h>
 #include <assert.h>
 
 DECOMP_SIZE_ASSERT(MxWavePresenter, 0x6c);
 DECOMP_SIZE_ASSERT(MxWavePresenter::WaveFormat, 0x18);
 
+std::atomic<MxU32> MxWavePresenter::g_residentBytes(0);
+std::atomic<MxU32> MxWavePresenter::g_peakResidentBytes(0);
+
 // FUNCTION: LEGO1 0x100b1ad0
 void MxWavePresenter::Init()
 {
@@ -27,6 +31,10 @@ void MxWavePresenter::Init()
 	m_started = FALSE;
 	m_is3d = FALSE;
 	m_paused = FALSE;
+	m_chunkOffset = 0;
+	m_underruns = 0;
+	m_residentBytes = 0;
+	m_drained = FALSE;
 }
 
 // FUNCTION: LEGO1 0x100b1af0
@@ -40,6 +48,17 @@ MxResult MxWavePresenter::AddToManager()
 // FUNCTION: LEGO1 0x100b1b10
 void MxWavePresenter::Destroy(MxBool p_fromDestructor)
 {
+	if (m_underruns) {
+		SDL_LogDebug(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"%s: %u audio underruns with a %u ms buffer",
+			m_action && m_action->GetObjectName() ? m_action->GetObjectName() : ClassName(),
+			m_underruns,
+			m_rb ? (MxU32) (ma_pcm_rb_get_subbuffer_size(m_rb) * 1000 / m_waveFormat->m_samplesPerSec) : 0
+		);
+	}
+
+	SetResidentBytes(0);
 	m_sound.Destroy(ma_sound_uninit);
 	m_rb.Destroy(ma_pcm_rb_uninit);
 	m_ab.m_buffer.Destroy(ma_audio_buffer_uninit);
@@ -66,34 +85,81 @@ MxBool MxWavePresenter::WriteToSoundBuffer(void* p_audioPtr, MxU32 p_length)
 		return TRUE;
 	}
 	else {
-		ma_uint32 requestedFrames =
+		MxU32 bytesPerFrame = ma_get_bytes_per_frame(m_rb->format, m_rb->channels);
+		MxU32 chunkFrames =
 			ma_calculate_buffer_size_in_frames_from_milliseconds(g_millisecondsPerChunk, m_waveFormat->m_samplesPerSec);
-		ma_uint32 acquiredFrames = requestedFrames;
-		void* bufferOut;
+		MxU32 chunkBytes = chunkFrames * bytesPerFrame;
+		assert(p_length <= chunkBytes);
 
-		ma_pcm_rb_acquire_write(m_rb, &acquiredFrames, &bufferOut);
+		// [library:audio] Write as much of the chunk as currently fits and keep the rest for the next tickle,
+		// rather than waiting for room for a full chunk. This keeps the ring topped up after a long frame.
+		while (m_chunkOffset < chunkBytes) {
+			ma_uint32 acquiredFrames = (chunkBytes - m_chunkOffset) / bytesPerFrame;
+			void* bufferOut;
 
-		// [library:audio] If there isn't enough space in the buffer for a full chunk, try again later.
-		if (acquiredFrames != requestedFrames) {
-			ma_pcm_rb_commit_write(m_rb, 0);
-			return FALSE;
-		}
+			ma_pcm_rb_acquire_write(m_rb, &acquiredFrames, &bufferOut);
+
+			if (!acquiredFrames) {
+				ma_pcm_rb_commit_write(m_rb, 0);
+				break;
+			}
 
-		ma_uint32 acquiredBytes = acquiredFrames * ma_get_bytes_per_frame(m_rb->format, m_rb->channels);
-		assert(p_length <= acquiredBytes);
+			MxU32 acquiredBytes = acquiredFrames * bytesPerFrame;
+			MxU32 dataBytes = 0;
 
-		memcpy(bufferOut, p_audioPtr, p_length);
+			if (m_chunkOffset < p_length) {
+				dataBytes = SDL_min(p_length - m_chunkOffset, acquiredBytes);
+				memcpy(bufferOut, (MxU8*) p_audioPtr + m_chunkOffset, dataBytes);
+			}
+
+			// [library:audio] Pad with silence data if we don't have a full chunk.
+			if (dataBytes < acquiredBytes) {
+				memset((ma_uint8*) bufferOut + dataBytes, m_silenceData, acquiredBytes - dataBytes);
+			}
+
+			ma_pcm_rb_commit_write(m_rb, acquiredFrames);
+			m_chunkOffset += acquiredBytes;
+		}
 
-		// [library:audio] Pad with silence data if we don't have a full chunk.
-		if (p_length < acquiredBytes) {
-			memset((ma_uint8*) bufferOut + p_length, m_silenceData, acquiredBytes - p_length);
+		if (m_chunkOffset < chunkBytes) {
+			return FALSE;
 		}
 
-		ma_pcm_rb_commit_write(m_rb, acquiredFrames);
+		m_chunkOffset = 0;
 		return TRUE;
 	}
 }
 
+// Default mode keeps the original two chunks of buffering. In low latency mode the ring only has to bridge
+// the longest recent gap between two sound manager tickles, with some margin.
+MxU32 MxWavePresenter::GetRbSizeInMilliseconds()
+{
+	if (!MxOmni::IsLowLatencyAudio()) {
+		return g_rbSizeInMilliseconds;
+	}
+
+	MxU32 size = MSoundManager()->GetPeakTickleGap() * g_lowLatencyRbTickleGaps;
+	return SDL_clamp(size, g_minLowLatencyRbSizeInMilliseconds, g_rbSizeInMilliseconds);
+}
+
+// Accounts this presenter's PCM memory in the shared resident and peak totals
+void MxWavePresenter::SetResidentBytes(MxU32 p_bytes)
+{
+	if (p_bytes == m_residentBytes) {
+		return;
+	}
+
+	// Unsigned wraparound makes this a subtraction when the presenter shrinks
+	MxU32 delta = p_bytes - m_residentBytes;
+	MxU32 total = g_residentBytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+
+	MxU32 peak = g_peakResidentBytes.load(std::memory_order_relaxed);
+	while (total > peak && !g_peakResidentBytes.compare_exchange_weak(peak, total, std::memory_order_relaxed)) {
+	}
+
+	m_residentBytes = p_bytes;
+}
+
 // FUNCTION: LEGO1 0x100b1cf0
 void MxWavePresenter::ReadyTickle()
 {
@@ -140,6 +206,7 @@ void MxWavePresenter::StartingTickle()
 
 			m_ab.m_length = ma_get_bytes_per_frame(format, channels) * sizeInFrames;
 			m_ab.m_data = new MxU8[m_ab.m_length];
+			SetResidentBytes(m_ab.m_length);
 
 			ma_audio_buffer_config config =
 				ma_audio_buffer_config_init(format, channels, sizeInFrames, m_ab.m_data, NULL);
@@ -154,7 +221,7 @@ void MxWavePresenter::StartingTickle()
 					ma_pcm_rb_init,
 					format,
 					channels,
-					ma_calculate_buffer_size_in_frames_from_milliseconds(g_rbSizeInMilliseconds, sampleRate),
+					ma_calculate_buffer_size_in_frames_from_milliseconds(GetRbSizeInMilliseconds(), sampleRate),
 					nullptr,
 					nullptr
 				) != MA_SUCCESS) {
@@ -162,6 +229,7 @@ void MxWavePresenter::StartingTickle()
 			}
 
 			ma_pcm_rb_set_sample_rate(m_rb, sampleRate);
+			SetResidentBytes(ma_pcm_rb_get_subbuffer_size(m_rb) * ma_get_bytes_per_frame(format, channels));
 		}
 
 		if (m_sound.Init(
@@ -240,6 +308,18 @@ MxResult MxWavePresenter::PutData()
 	if (IsEnabled()) {
 		switch (m_currentTickleState) {
 		case e_streaming:
+			// The mixer drained the ring before this tickle: the sound has gone silent mid-stream.
+			if (m_rb && m_started && !m_paused && ma_pcm_rb_pointer_distance(m_rb) == 0) {
+				if (!m_drained) {
+					m_drained = TRUE;
+					m_underruns++;
+					MSoundManager()->CountUnderrun();
+				}
+			}
+			else {
+				m_drained = FALSE;
+			}
+
 			if (m_currentChunk && WriteToSoundBuffer(m_currentChunk->GetData(), m_currentChunk->GetLength())) {
 				m_subscriber->FreeDataChunk(m_currentChunk);
 				m_currentChunk = NULL;
@@ -5,6 +5,7 @@
 #include "mxautolock.h"
 #include "mxdsmultiaction.h"
 #include "mxeventmanager.h"
+#include "mxjobpool.h"
 #include "mxmisc.h"
 #include "mxnotificationmanager.h"
 #include "mxobjectfactory.h"
@@ -15,6 +16,7 @@
 #include "mxticklemanager.h"
 #include "mxtimer.h"
 #include "mxvariabletable.h"
+#include "mxvideodecoder.h"
 #include "mxvideomanager.h"
 
 #include <SDL3/SDL_filesystem.h>
@@ -29,6 +31,8 @@ MxString g_cdPath = "E:";
 // GLOBAL: LEGO1 0x10101db8
 MxBool g_use3dSound = FALSE;
 
+MxBool g_lowLatencyAudio = FALSE;
+
 // GLOBAL: LEGO1 0x101015b0
 MxOmni* MxOmni::g_instance = NULL;
 
@@ -206,6 +210,11 @@ void MxOmni::Destroy()
 	delete m_soundManager;
 	delete m_videoManager;
 	delete m_streamer;
+
+	// Video and model presenters have been destroyed with the streamer, so the workers can be stopped
+	MxVideoDecodePool::Shutdown();
+	MxJobPool::Shutdown();
+
 	delete m_timer;
 	delete m_objectFactory;
 	delete m_variableTable;
@@ -406,6 +415,16 @@ void MxOmni::SetSound3D(MxBool p_use3dSound)
 	g_use3dSound = p_use3dSound;
 }
 
+MxBool MxOmni::IsLowLatencyAudio()
+{
+	return g_lowLatencyAudio;
+}
+
+void MxOmni::SetLowLatencyAudio(MxBool p_lowLatencyAudio)
+{
+	g_lowLatencyAudio = p_lowLatencyAudio;
+}
+
 // FUNCTION: LEGO1 0x100b09a0
 // FUNCTION: BETA10 0x101309f5
 MxBool MxOmni::DoesEntityExist(MxDSAction& p_dsAction)
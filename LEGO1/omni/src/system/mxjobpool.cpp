@@ -0,0 +1,156 @@
+#include "mxjobpool.h"
+
+#include "mxautolock.h"
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_timer.h>
+
+// Loading is bounded by the tickle thread creating device resources, a couple of workers keep up with it
+#define MAX_JOB_THREADS 2
+
+static MxJobPool* g_jobPool = NULL;
+static MxBool g_jobPoolFailed = FALSE;
+
+MxResult MxJobThread::Run()
+{
+	while (IsRunning() && m_pool->RunJob()) {
+	}
+
+	return MxThread::Run();
+}
+
+MxJobPool::MxJobPool() : m_shutdown(FALSE)
+{
+}
+
+MxJobPool::~MxJobPool()
+{
+	m_shutdown = TRUE;
+
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_jobSemaphore.Release();
+	}
+
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_threads[i]->Terminate();
+		delete m_threads[i];
+	}
+}
+
+MxResult MxJobPool::Create(MxS32 p_numThreads)
+{
+	if (m_jobSemaphore.Init(0, 100) != SUCCESS) {
+		return FAILURE;
+	}
+
+	for (MxS32 i = 0; i < p_numThreads; i++) {
+		MxJobThread* thread = new MxJobThread(this);
+
+		if (thread->Start(0, 0) != SUCCESS) {
+			delete thread;
+			break;
+		}
+
+		m_threads.push_back(thread);
+	}
+
+	return m_threads.empty() ? FAILURE : SUCCESS;
+}
+
+MxBool MxJobPool::RunJob()
+{
+	m_jobSemaphore.Acquire();
+
+	MxJob* job;
+
+	{
+		AUTOLOCK(m_criticalSection);
+
+		if (m_shutdown) {
+			return FALSE;
+		}
+
+		// The job may have been cancelled after it was signalled
+		if (m_jobs.empty()) {
+			return TRUE;
+		}
+
+		job = m_jobs.front();
+		m_jobs.pop_front();
+	}
+
+	job->Run();
+	job->m_done.store(TRUE, std::memory_order_release);
+	return TRUE;
+}
+
+MxBool MxJobPool::IsAvailable()
+{
+	if (g_jobPool) {
+		return TRUE;
+	}
+
+	if (g_jobPoolFailed) {
+		return FALSE;
+	}
+
+	// Keep one core for the game loop
+	MxS32 numThreads = SDL_GetNumLogicalCPUCores() - 1;
+	if (numThreads > MAX_JOB_THREADS) {
+		numThreads = MAX_JOB_THREADS;
+	}
+
+	MxJobPool* pool = new MxJobPool;
+	if (numThreads < 1 || pool->Create(numThreads) != SUCCESS) {
+		delete pool;
+		g_jobPoolFailed = TRUE;
+		return FALSE;
+	}
+
+	g_jobPool = pool;
+	return TRUE;
+}
+
+void MxJobPool::Schedule(MxJob* p_job)
+{
+	if (!IsAvailable()) {
+		p_job->Run();
+		p_job->m_done.store(TRUE, std::memory_order_release);
+		return;
+	}
+
+	{
+		AUTOLOCK(g_jobPool->m_criticalSection);
+		g_jobPool->m_jobs.push_back(p_job);
+	}
+
+	g_jobPool->m_jobSemaphore.Release();
+}
+
+void MxJobPool::Cancel(MxJob* p_job)
+{
+	if (g_jobPool) {
+		{
+			AUTOLOCK(g_jobPool->m_criticalSection);
+
+			for (std::deque<MxJob*>::iterator it = g_jobPool->m_jobs.begin(); it != g_jobPool->m_jobs.end(); it++) {
+				if (*it == p_job) {
+					g_jobPool->m_jobs.erase(it);
+					return;
+				}
+			}
+		}
+
+		// Not queued, so a worker has it or already finished it
+		while (!p_job->IsDone()) {
+			SDL_Delay(1);
+		}
+	}
+}
+
+void MxJobPool::Shutdown()
+{
+	delete g_jobPool;
+	g_jobPool = NULL;
+	g_jobPoolFailed = FALSE;
+}
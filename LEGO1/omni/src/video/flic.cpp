@@ -48,6 +48,36 @@ void DecodeSS2(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, BYTE* p_dat
 void DecodeBlack(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, BYTE* p_data, FLIC_HEADER* p_flcHeader);
 void DecodeCopy(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, BYTE* p_data, FLIC_HEADER* p_flcHeader);
 
+// Repeats a two-byte pixel pattern over p_count bytes, eight bytes at a time.
+// An odd trailing byte receives the low byte of the pattern, as WritePixelPairs always did.
+static inline void FillPixelPairs(BYTE* p_dst, WORD p_pixel, short p_count)
+{
+	short pairBytes = p_count & ~1;
+	BYTE pair[sizeof(WORD)];
+	memcpy(pair, &p_pixel, sizeof(pair));
+
+	if (pair[0] == pair[1]) {
+		memset(p_dst, pair[0], pairBytes);
+	}
+	else {
+		// Multiplying replicates the word in memory order regardless of endianness
+		unsigned long long pattern = p_pixel * 0x0001000100010001ULL;
+		short i = 0;
+
+		for (; i + (short) sizeof(pattern) <= pairBytes; i += sizeof(pattern)) {
+			memcpy(p_dst + i, &pattern, sizeof(pattern));
+		}
+
+		for (; i < pairBytes; i += sizeof(WORD)) {
+			memcpy(p_dst + i, &p_pixel, sizeof(WORD));
+		}
+	}
+
+	if (p_count & 1) {
+		p_dst[pairBytes] = (BYTE) p_pixel;
+	}
+}
+
 // FUNCTION: LEGO1 0x100bd530
 // FUNCTION: BETA10 0x1013dd80
 void WritePixel(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, short p_column, short p_row, byte p_pixel)
@@ -133,10 +163,7 @@ void WritePixelRun(
 	}
 
 	BYTE* dst = ((p_bitmapHeader->biWidth + 3) & -4) * p_row + p_column + p_pixelData;
-
-	while (--p_count >= 0) {
-		*dst++ = p_pixel;
-	}
+	memset(dst, p_pixel, p_count);
 }
 
 // FUNCTION: LEGO1 0x100bd6e0
@@ -156,19 +183,8 @@ void WritePixelPairs(
 		return;
 	}
 
-	short is_odd = p_count & 1;
-	p_count >>= 1;
-
 	BYTE* dst = ((p_bitmapHeader->biWidth + 3) & -4) * p_row + p_column + p_pixelData;
-	while (--p_count >= 0) {
-		memcpy(dst, &p_pixel, sizeof(WORD));
-		dst += sizeof(WORD);
-	}
-
-	if (is_odd) {
-		BYTE* dst_byte = (BYTE*) dst;
-		*dst_byte = p_pixel;
-	}
+	FillPixelPairs(dst, p_pixel, p_count);
 }
 
 // FUNCTION: LEGO1 0x100bd760
@@ -293,18 +309,18 @@ void DecodeBrun(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, BYTE* p_da
 		while ((column += count) < width2) {
 			count = *data++;
 
-			short i;
 			if (count >= 0) {
-				for (i = 0; i < count; i++) {
-					*offset++ = *data;
-				}
-
-				data++;
+				memset(offset, *data++, count);
+				offset += count;
 			}
 			else {
 				count = -count;
-				for (i = 0; i < count; i++) {
-					*offset++ = *data++;
+
+				// A count of -128 negates back to itself and copies nothing
+				if (count > 0) {
+					memcpy(offset, data, count);
+					offset += count;
+					data += count;
 				}
 			}
 		}
@@ -461,14 +477,14 @@ void DecodeBlack(LPBITMAPINFOHEADER p_bitmapHeader, BYTE* p_pixelData, BYTE* p_d
 	short t_col = 0;
 	short t_row = 0;
 
-	BYTE pixel[2];
-	pixel[0] = pixel[1] = 0;
-
+	// Equivalent to the original pixel pair fill plus trailing odd pixel, clamped once per line
 	for (short i = height - 1; i >= 0; i--) {
-		WritePixelPairs(p_bitmapHeader, p_pixelData, t_col, t_row + i, *(WORD*) pixel, width / 2);
+		short column = t_col;
+		short row = t_row + i;
+		short count = width;
 
-		if (width & 1) {
-			WritePixel(p_bitmapHeader, p_pixelData, t_col + width - 1, t_row + i, 0);
+		if (ClampLine(p_bitmapHeader, column, row, count)) {
+			memset(((p_bitmapHeader->biWidth + 3) & -4) * row + column + p_pixelData, 0, count);
 		}
 	}
 }
@@ -43,6 +43,8 @@ void MxDisplaySurface::Init()
 	m_32bitPal = NULL;
 	m_initialized = FALSE;
 	memset(&m_surfaceDesc, 0, sizeof(m_surfaceDesc));
+	memset(m_stagingSurfaces, 0, sizeof(m_stagingSurfaces));
+	m_stagingUseCount = 0;
 }
 
 // FUNCTION: LEGO1 0x100ba640
@@ -276,6 +278,8 @@ MxResult MxDisplaySurface::Create(MxVideoParam& p_videoParam)
 // FUNCTION: LEGO1 0x100baa90
 void MxDisplaySurface::Destroy()
 {
+	ReleaseStagingSurfaces();
+
 	if (m_initialized) {
 		if (m_ddSurface2) {
 			m_ddSurface2->Release();
@@ -411,31 +415,15 @@ void MxDisplaySurface::VTable0x28(
 		)) {
 		return;
 	}
-	DDSURFACEDESC ddsd;
-	memset(&ddsd, 0, sizeof(ddsd));
-	ddsd.dwSize = sizeof(ddsd);
-	ddsd.dwFlags = DDSD_WIDTH | DDSD_HEIGHT | DDSD_PIXELFORMAT | DDSD_CAPS;
-	ddsd.dwWidth = p_width;
-	ddsd.dwHeight = p_height;
-#ifdef MINIWIN
-	ddsd.ddpfPixelFormat.dwSize = sizeof(DDPIXELFORMAT);
-	ddsd.ddpfPixelFormat.dwFlags = DDPF_PALETTEINDEXED8 | DDPF_RGB;
-	ddsd.ddpfPixelFormat.dwRGBBitCount = 8;
-#else
-	ddsd.ddpfPixelFormat = m_surfaceDesc.ddpfPixelFormat;
-#endif
-	ddsd.ddsCaps.dwCaps = DDSCAPS_OFFSCREENPLAIN;
-
-	LPDIRECTDRAWSURFACE tempSurface = nullptr;
-	LPDIRECTDRAW draw = MVideoManager()->GetDirectDraw();
-	HRESULT hr = draw->CreateSurface(&ddsd, &tempSurface, nullptr);
-	if (hr != DD_OK || !tempSurface) {
+	LPDIRECTDRAWSURFACE tempSurface = GetStagingSurface(p_width, p_height, FALSE);
+	if (!tempSurface) {
 		return;
 	}
 
 #ifdef MINIWIN
 	MxBITMAPINFO* bmi = p_bitmap->GetBitmapInfo();
-	if (bmi) {
+	LPDIRECTDRAWPALETTE palette = nullptr;
+	if (bmi && tempSurface->GetPalette(&palette) == DD_OK) {
 		PALETTEENTRY pe[256];
 		for (int i = 0; i < 256; i++) {
 			pe[i].peRed = bmi->m_bmiColors[i].rgbRed;
@@ -444,11 +432,8 @@ void MxDisplaySurface::VTable0x28(
 			pe[i].peFlags = PC_NONE;
 		}
 
-		LPDIRECTDRAWPALETTE palette = nullptr;
-		if (draw->CreatePalette(DDPCAPS_8BIT | DDPCAPS_ALLOW256, pe, &palette, NULL) == DD_OK && palette) {
-			tempSurface->SetPalette(palette);
-			palette->Release();
-		}
+		palette->SetEntries(0, 0, 256, pe);
+		palette->Release();
 	}
 #endif
 
@@ -467,14 +452,13 @@ void MxDisplaySurface::VTable0x28(
 	memset(&tempDesc, 0, sizeof(tempDesc));
 	tempDesc.dwSize = sizeof(tempDesc);
 
-	hr = tempSurface->Lock(NULL, &tempDesc, DDLOCK_WAIT | DDLOCK_WRITEONLY, NULL);
+	HRESULT hr = tempSurface->Lock(NULL, &tempDesc, DDLOCK_WAIT | DDLOCK_WRITEONLY, NULL);
 	if (hr == DDERR_SURFACELOST) {
 		tempSurface->Restore();
 		hr = tempSurface->Lock(NULL, &tempDesc, DDLOCK_WAIT | DDLOCK_WRITEONLY, NULL);
 	}
 
 	if (hr != DD_OK) {
-		tempSurface->Release();
 		return;
 	}
 
@@ -519,8 +503,6 @@ void MxDisplaySurface::VTable0x28(
 	else {
 		m_ddSurface2->BltFast(p_right, p_bottom, tempSurface, NULL, DDBLTFAST_WAIT | DDBLTFAST_SRCCOLORKEY);
 	}
-
-	tempSurface->Release();
 }
 
 // FUNCTION: LEGO1 0x100bb1d0
@@ -549,31 +531,17 @@ void MxDisplaySurface::VTable0x30(
 		)) {
 		return;
 	}
-	DDSURFACEDESC ddsd;
-	memset(&ddsd, 0, sizeof(ddsd));
-	ddsd.dwSize = sizeof(ddsd);
-	ddsd.dwFlags = DDSD_WIDTH | DDSD_HEIGHT | DDSD_PIXELFORMAT | DDSD_CAPS;
-	ddsd.dwWidth = p_width;
-	ddsd.dwHeight = p_height;
-#ifdef MINIWIN
-	ddsd.ddpfPixelFormat.dwSize = sizeof(DDPIXELFORMAT);
-	ddsd.ddpfPixelFormat.dwFlags = DDPF_PALETTEINDEXED8 | DDPF_RGB;
-	ddsd.ddpfPixelFormat.dwRGBBitCount = 8;
-#else
-	ddsd.ddpfPixelFormat = m_surfaceDesc.ddpfPixelFormat;
-#endif
-	ddsd.ddsCaps.dwCaps = DDSCAPS_OFFSCREENPLAIN;
-
-	LPDIRECTDRAW draw = MVideoManager()->GetDirectDraw();
-	LPDIRECTDRAWSURFACE tempSurface = nullptr;
-	if (draw->CreateSurface(&ddsd, &tempSurface, nullptr) != DD_OK || !tempSurface) {
+	LPDIRECTDRAWSURFACE tempSurface = GetStagingSurface(p_width, p_height, TRUE);
+	if (!tempSurface) {
 		return;
 	}
 
 #ifdef MINIWIN
 	MxBITMAPINFO* bmi = p_bitmap->GetBitmapInfo();
-	if (bmi) {
-		PALETTEENTRY pe[256];
+	LPDIRECTDRAWPALETTE palette = nullptr;
+	if (bmi && tempSurface->GetPalette(&palette) == DD_OK) {
+		// Index 0 is the color key and never drawn
+		PALETTEENTRY pe[256] = {};
 		for (int i = 1; i < 256; i++) {
 			pe[i].peRed = bmi->m_bmiColors[i].rgbRed;
 			pe[i].peGreen = bmi->m_bmiColors[i].rgbGreen;
@@ -581,11 +549,8 @@ void MxDisplaySurface::VTable0x30(
 			pe[i].peFlags = PC_NONE;
 		}
 
-		LPDIRECTDRAWPALETTE palette = nullptr;
-		if (draw->CreatePalette(DDPCAPS_8BIT | DDPCAPS_ALLOW256, pe, &palette, NULL) == DD_OK && palette) {
-			tempSurface->SetPalette(palette);
-			palette->Release();
-		}
+		palette->SetEntries(0, 0, 256, pe);
+		palette->Release();
 	}
 #endif
 
@@ -598,7 +563,6 @@ void MxDisplaySurface::VTable0x30(
 	tempDesc.dwSize = sizeof(tempDesc);
 
 	if (tempSurface->Lock(NULL, &tempDesc, DDLOCK_WAIT | DDLOCK_WRITEONLY, NULL) != DD_OK) {
-		tempSurface->Release();
 		return;
 	}
 
@@ -610,20 +574,20 @@ void MxDisplaySurface::VTable0x30(
 	MxLong stride = -p_width + GetAdjustedStride(p_bitmap);
 	MxLong length = -bytesPerPixel * p_width + tempDesc.lPitch;
 
+	// The pooled surface still holds the previous bitmap, so transparent pixels are written as the color key
+	// rather than skipped
 	for (MxS32 i = 0; i < p_height; i++) {
 		for (MxS32 j = 0; j < p_width; j++) {
-			if (*data != 0) {
-				switch (bytesPerPixel) {
-				case 1:
-					*surface = *data;
-					break;
-				case 2:
-					*(MxU16*) surface = m_16bitPal[*data];
-					break;
-				default:
-					*(MxU32*) surface = m_32bitPal[*data];
-					break;
-				}
+			switch (bytesPerPixel) {
+			case 1:
+				*surface = *data;
+				break;
+			case 2:
+				*(MxU16*) surface = *data ? m_16bitPal[*data] : 0;
+				break;
+			default:
+				*(MxU32*) surface = *data ? m_32bitPal[*data] : 0;
+				break;
 			}
 			data++;
 			surface += bytesPerPixel;
@@ -635,8 +599,84 @@ void MxDisplaySurface::VTable0x30(
 	tempSurface->Unlock(NULL);
 
 	m_ddSurface2->BltFast(p_right, p_bottom, tempSurface, NULL, DDBLTFAST_WAIT | DDBLTFAST_SRCCOLORKEY);
+}
+
+LPDIRECTDRAWSURFACE MxDisplaySurface::GetStagingSurface(MxS32 p_width, MxS32 p_height, MxBool p_transparent)
+{
+	StagingSurface* entry = NULL;
+	MxU32 i;
 
-	tempSurface->Release();
+	for (i = 0; i < sizeOfArray(m_stagingSurfaces); i++) {
+		if (m_stagingSurfaces[i].m_surface && m_stagingSurfaces[i].m_width == p_width &&
+			m_stagingSurfaces[i].m_height == p_height && m_stagingSurfaces[i].m_transparent == p_transparent) {
+			entry = &m_stagingSurfaces[i];
+			break;
+		}
+	}
+
+	if (entry == NULL) {
+		// Take a free slot, or replace the least recently used surface
+		entry = &m_stagingSurfaces[0];
+		for (i = 0; i < sizeOfArray(m_stagingSurfaces) && entry->m_surface; i++) {
+			if (!m_stagingSurfaces[i].m_surface || m_stagingSurfaces[i].m_lastUse < entry->m_lastUse) {
+				entry = &m_stagingSurfaces[i];
+			}
+		}
+
+		if (entry->m_surface) {
+			entry->m_surface->Release();
+			entry->m_surface = NULL;
+		}
+
+		DDSURFACEDESC ddsd;
+		memset(&ddsd, 0, sizeof(ddsd));
+		ddsd.dwSize = sizeof(ddsd);
+		ddsd.dwFlags = DDSD_WIDTH | DDSD_HEIGHT | DDSD_PIXELFORMAT | DDSD_CAPS;
+		ddsd.dwWidth = p_width;
+		ddsd.dwHeight = p_height;
+#ifdef MINIWIN
+		ddsd.ddpfPixelFormat.dwSize = sizeof(DDPIXELFORMAT);
+		ddsd.ddpfPixelFormat.dwFlags = DDPF_PALETTEINDEXED8 | DDPF_RGB;
+		ddsd.ddpfPixelFormat.dwRGBBitCount = 8;
+#else
+		ddsd.ddpfPixelFormat = m_surfaceDesc.ddpfPixelFormat;
+#endif
+		ddsd.ddsCaps.dwCaps = DDSCAPS_OFFSCREENPLAIN;
+
+		LPDIRECTDRAW draw = MVideoManager()->GetDirectDraw();
+		LPDIRECTDRAWSURFACE surface = nullptr;
+		if (draw->CreateSurface(&ddsd, &surface, nullptr) != DD_OK || !surface) {
+			return NULL;
+		}
+
+#ifdef MINIWIN
+		// The palette stays with the surface, callers update its entries for each bitmap
+		PALETTEENTRY pe[256] = {};
+		LPDIRECTDRAWPALETTE palette = nullptr;
+		if (draw->CreatePalette(DDPCAPS_8BIT | DDPCAPS_ALLOW256, pe, &palette, NULL) == DD_OK && palette) {
+			surface->SetPalette(palette);
+			palette->Release();
+		}
+#endif
+
+		entry->m_surface = surface;
+		entry->m_width = p_width;
+		entry->m_height = p_height;
+		entry->m_transparent = p_transparent;
+	}
+
+	entry->m_lastUse = ++m_stagingUseCount;
+	return entry->m_surface;
+}
+
+void MxDisplaySurface::ReleaseStagingSurfaces()
+{
+	for (MxU32 i = 0; i < sizeOfArray(m_stagingSurfaces); i++) {
+		if (m_stagingSurfaces[i].m_surface) {
+			m_stagingSurfaces[i].m_surface->Release();
+			m_stagingSurfaces[i].m_surface = NULL;
+		}
+	}
 }
 
 // FUNCTION: LEGO1 0x100bba50
@@ -13,6 +13,7 @@ DECOMP_SIZE_ASSERT(MxFlcPresenter, 0x68);
 MxFlcPresenter::MxFlcPresenter()
 {
 	m_flcHeader = NULL;
+	m_decodeBitmap = NULL;
 	SetUseSurface(FALSE);
 	SetUseVideoMemory(FALSE);
 }
@@ -20,6 +21,10 @@ MxFlcPresenter::MxFlcPresenter()
 // FUNCTION: LEGO1 0x100b3420
 MxFlcPresenter::~MxFlcPresenter()
 {
+	// A decode worker may still be reading the header
+	StopBackgroundDecode();
+	delete m_decodeBitmap;
+
 	if (this->m_flcHeader) {
 		delete[] ((MxU8*) this->m_flcHeader);
 	}
@@ -41,6 +46,9 @@ void MxFlcPresenter::CreateBitmap()
 
 	m_frameBitmap = new MxBitmap;
 	m_frameBitmap->SetSize(m_flcHeader->width, m_flcHeader->height, NULL, FALSE);
+
+	delete m_decodeBitmap;
+	m_decodeBitmap = NULL;
 }
 
 // FUNCTION: LEGO1 0x100b3570
@@ -76,6 +84,42 @@ void MxFlcPresenter::LoadFrame(MxStreamChunk* p_chunk)
 	}
 }
 
+void MxFlcPresenter::DecodeFrame(MxVideoDecodeQueue::Frame& p_frame)
+{
+	if (!m_decodeBitmap) {
+		m_decodeBitmap = new MxBitmap;
+		m_decodeBitmap->SetSize(m_flcHeader->width, m_flcHeader->height, NULL, FALSE);
+	}
+
+	MxU8* data = p_frame.m_chunk->GetData();
+
+	MxS32 rectCount = UnalignedRead<MxS32>(data);
+	data += sizeof(MxS32);
+
+	MxU8* rects = data;
+	data += rectCount * sizeof(MxRect32);
+
+	DecodeFLCFrame(
+		&m_decodeBitmap->GetBitmapInfo()->m_bmiHeader,
+		m_decodeBitmap->GetImage(),
+		m_flcHeader,
+		(FLIC_FRAME*) data,
+		&p_frame.m_paletteChanged
+	);
+
+	memcpy(p_frame.m_bitmap->GetImage(), m_decodeBitmap->GetImage(), m_decodeBitmap->GetDataSize());
+	memcpy(
+		p_frame.m_bitmap->GetBitmapInfo()->m_bmiColors,
+		m_decodeBitmap->GetBitmapInfo()->m_bmiColors,
+		sizeof(m_decodeBitmap->GetBitmapInfo()->m_bmiColors)
+	);
+
+	for (MxS32 i = 0; i < rectCount; i++) {
+		p_frame.m_rects.push_back(UnalignedRead<MxRect32>(rects));
+		rects += sizeof(MxRect32);
+	}
+}
+
 // FUNCTION: LEGO1 0x100b3620
 void MxFlcPresenter::RealizePalette()
 {
@@ -34,6 +34,9 @@ void MxSmkPresenter::Init()
 // FUNCTION: LEGO1 0x100b3900
 void MxSmkPresenter::Destroy(MxBool p_fromDestructor)
 {
+	// A decode worker may still be using the smacker handle
+	StopBackgroundDecode();
+
 	ENTER(m_criticalSection);
 
 	MxSmk::Destroy(&m_mxSmk);
@@ -95,6 +98,43 @@ void MxSmkPresenter::LoadFrame(MxStreamChunk* p_chunk)
 	}
 }
 
+void MxSmkPresenter::DecodeFrame(MxVideoDecodeQueue::Frame& p_frame)
+{
+	MxBITMAPINFO* bitmapInfo = p_frame.m_bitmap->GetBitmapInfo();
+
+	m_currentFrame++;
+	ResetCurrentFrameAtEnd();
+
+	MxRect32List rects(TRUE);
+	MxSmk::LoadFrame(
+		bitmapInfo,
+		p_frame.m_bitmap->GetImage(),
+		&m_mxSmk,
+		p_frame.m_chunk->GetData(),
+		p_frame.m_paletteChanged,
+		m_currentFrame - 1,
+		&rects
+	);
+
+	// Each ring bitmap has its own color table, so it has to be refreshed on every frame
+	if (!p_frame.m_paletteChanged) {
+		const unsigned char* palette = smk_get_palette(m_mxSmk.m_smk);
+
+		for (MxU32 i = 0; i < 256; i++) {
+			bitmapInfo->m_bmiColors[i].rgbBlue = palette[i * 3 + 2];
+			bitmapInfo->m_bmiColors[i].rgbGreen = palette[i * 3 + 1];
+			bitmapInfo->m_bmiColors[i].rgbRed = palette[i * 3];
+		}
+	}
+
+	MxRect32ListCursor cursor(&rects);
+	MxRect32* rect;
+
+	while (cursor.Next(rect)) {
+		p_frame.m_rects.push_back(*rect);
+	}
+}
+
 // FUNCTION: LEGO1 0x100b4260
 void MxSmkPresenter::ResetCurrentFrameAtEnd()
 {
@@ -0,0 +1,288 @@
+#include "mxvideodecoder.h"
+
+#include "mxautolock.h"
+#include "mxbitmap.h"
+#include "mxdsaction.h"
+#include "mxvideopresenter.h"
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_timer.h>
+
+// Upper bound on decode workers; a handful of concurrent streams is the most the game ever plays
+#define MAX_DECODE_THREADS 4
+
+static MxVideoDecodePool* g_videoDecodePool = NULL;
+static MxBool g_videoDecodePoolFailed = FALSE;
+
+MxVideoDecodeQueue::MxVideoDecodeQueue(MxVideoPresenter* p_presenter)
+	: m_presenter(p_presenter), m_head(0), m_tail(0), m_decodeIndex(0), m_submitted(0), m_scheduled(FALSE),
+	  m_activeWorkers(0), m_cancelled(FALSE), m_lastLateFrame(NULL), m_framesPresented(0), m_framesLate(0),
+	  m_framesDropped(0)
+{
+	for (MxU32 i = 0; i < c_numFrames; i++) {
+		m_frames[i].m_chunk = NULL;
+		m_frames[i].m_bitmap = NULL;
+		m_frames[i].m_paletteChanged = FALSE;
+		m_frames[i].m_decoded = FALSE;
+	}
+}
+
+MxVideoDecodeQueue* MxVideoDecodeQueue::Create(MxVideoPresenter* p_presenter, MxBitmap* p_frameBitmap)
+{
+	if (!p_frameBitmap || !MxVideoDecodePool::IsAvailable()) {
+		return NULL;
+	}
+
+	MxVideoDecodeQueue* queue = new MxVideoDecodeQueue(p_presenter);
+
+	for (MxU32 i = 0; i < c_numFrames; i++) {
+		MxBitmap* bitmap = new MxBitmap;
+
+		if (bitmap->SetSize(p_frameBitmap->GetBmiWidth(), p_frameBitmap->GetBmiHeightAbs(), NULL, FALSE) !=
+			SUCCESS) {
+			delete bitmap;
+			delete queue;
+			return NULL;
+		}
+
+		queue->m_frames[i].m_bitmap = bitmap;
+	}
+
+	return queue;
+}
+
+MxVideoDecodeQueue::~MxVideoDecodeQueue()
+{
+	Cancel();
+
+	if (m_framesLate || m_framesDropped) {
+		MxDSAction* action = m_presenter->GetAction();
+		const char* name = action && action->GetObjectName() ? action->GetObjectName() : m_presenter->ClassName();
+
+		SDL_LogDebug(
+			SDL_LOG_CATEGORY_APPLICATION,
+			"%s: %u frames presented, %u late, %u dropped",
+			name,
+			m_framesPresented,
+			m_framesLate,
+			m_framesDropped
+		);
+	}
+
+	for (MxU32 i = 0; i < c_numFrames; i++) {
+		delete m_frames[i].m_bitmap;
+	}
+}
+
+void MxVideoDecodeQueue::Submit(MxStreamChunk* p_chunk)
+{
+	Frame& frame = m_frames[m_tail % c_numFrames];
+	frame.m_chunk = p_chunk;
+	frame.m_rects.clear();
+	frame.m_paletteChanged = FALSE;
+	m_tail++;
+
+	// Paired with the store to m_scheduled in Decode(): either the worker sees the new frame
+	// before giving up its claim, or we see the claim released and reschedule.
+	m_submitted.store(m_tail);
+	if (!m_scheduled.exchange(TRUE)) {
+		MxVideoDecodePool::Schedule(this);
+	}
+}
+
+void MxVideoDecodeQueue::Pop()
+{
+	Frame& frame = m_frames[m_head % c_numFrames];
+	frame.m_chunk = NULL;
+	frame.m_decoded.store(FALSE, std::memory_order_relaxed);
+	m_head++;
+}
+
+void MxVideoDecodeQueue::Cancel()
+{
+	if (!m_cancelled.exchange(TRUE)) {
+		MxVideoDecodePool::Cancel(this);
+	}
+}
+
+void MxVideoDecodeQueue::CountLate(Frame* p_frame)
+{
+	if (m_lastLateFrame != p_frame) {
+		m_lastLateFrame = p_frame;
+		m_framesLate++;
+	}
+}
+
+void MxVideoDecodeQueue::CountPresented(MxU32 p_count)
+{
+	m_lastLateFrame = NULL;
+	m_framesPresented += p_count;
+
+	if (p_count > 1) {
+		m_framesDropped += p_count - 1;
+	}
+}
+
+void MxVideoDecodeQueue::Decode()
+{
+	for (;;) {
+		while (!m_cancelled.load(std::memory_order_relaxed) && m_decodeIndex != m_submitted.load()) {
+			Frame& frame = m_frames[m_decodeIndex % c_numFrames];
+			m_presenter->DecodeFrame(frame);
+			frame.m_decoded.store(TRUE, std::memory_order_release);
+			m_decodeIndex++;
+		}
+
+		// Once the claim is released another worker may pick the queue up, so only the local copy is safe to read
+		MxU32 decoded = m_decodeIndex;
+		m_scheduled.store(FALSE);
+
+		if (m_cancelled.load() || decoded == m_submitted.load() || m_scheduled.exchange(TRUE)) {
+			break;
+		}
+	}
+}
+
+MxResult MxVideoDecodeThread::Run()
+{
+	while (IsRunning() && m_pool->RunJob()) {
+	}
+
+	return MxThread::Run();
+}
+
+MxVideoDecodePool::MxVideoDecodePool() : m_shutdown(FALSE)
+{
+}
+
+MxVideoDecodePool::~MxVideoDecodePool()
+{
+	m_shutdown = TRUE;
+
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_jobSemaphore.Release();
+	}
+
+	for (size_t i = 0; i < m_threads.size(); i++) {
+		m_threads[i]->Terminate();
+		delete m_threads[i];
+	}
+}
+
+MxResult MxVideoDecodePool::Create(MxS32 p_numThreads)
+{
+	if (m_jobSemaphore.Init(0, 100) != SUCCESS) {
+		return FAILURE;
+	}
+
+	for (MxS32 i = 0; i < p_numThreads; i++) {
+		MxVideoDecodeThread* thread = new MxVideoDecodeThread(this);
+
+		if (thread->Start(0, 0) != SUCCESS) {
+			delete thread;
+			break;
+		}
+
+		m_threads.push_back(thread);
+	}
+
+	return m_threads.empty() ? FAILURE : SUCCESS;
+}
+
+MxBool MxVideoDecodePool::RunJob()
+{
+	m_jobSemaphore.Acquire();
+
+	MxVideoDecodeQueue* queue;
+
+	{
+		AUTOLOCK(m_criticalSection);
+
+		if (m_shutdown) {
+			return FALSE;
+		}
+
+		// The job may have been cancelled after it was signalled
+		if (m_jobs.empty()) {
+			return TRUE;
+		}
+
+		queue = m_jobs.front();
+		m_jobs.pop_front();
+		queue->m_activeWorkers++;
+	}
+
+	queue->Decode();
+	queue->m_activeWorkers--;
+	return TRUE;
+}
+
+MxBool MxVideoDecodePool::IsAvailable()
+{
+	if (g_videoDecodePool) {
+		return TRUE;
+	}
+
+	if (g_videoDecodePoolFailed) {
+		return FALSE;
+	}
+
+	// Keep one core for the game loop; on a single core machine decoding inline is cheaper
+	MxS32 numThreads = SDL_GetNumLogicalCPUCores() - 1;
+	if (numThreads > MAX_DECODE_THREADS) {
+		numThreads = MAX_DECODE_THREADS;
+	}
+
+	MxVideoDecodePool* pool = new MxVideoDecodePool;
+	if (numThreads < 1 || pool->Create(numThreads) != SUCCESS) {
+		delete pool;
+		g_videoDecodePoolFailed = TRUE;
+		return FALSE;
+	}
+
+	g_videoDecodePool = pool;
+	return TRUE;
+}
+
+void MxVideoDecodePool::Schedule(MxVideoDecodeQueue* p_queue)
+{
+	if (g_videoDecodePool) {
+		{
+			AUTOLOCK(g_videoDecodePool->m_criticalSection);
+			g_videoDecodePool->m_jobs.push_back(p_queue);
+		}
+
+		g_videoDecodePool->m_jobSemaphore.Release();
+	}
+}
+
+void MxVideoDecodePool::Cancel(MxVideoDecodeQueue* p_queue)
+{
+	if (g_videoDecodePool) {
+		{
+			AUTOLOCK(g_videoDecodePool->m_criticalSection);
+
+			for (std::deque<MxVideoDecodeQueue*>::iterator it = g_videoDecodePool->m_jobs.begin();
+				 it != g_videoDecodePool->m_jobs.end();
+				 it++) {
+				if (*it == p_queue) {
+					g_videoDecodePool->m_jobs.erase(it);
+					break;
+				}
+			}
+		}
+
+		// A worker that already picked the queue up stops after its current frame
+		while (p_queue->m_activeWorkers) {
+			SDL_Delay(1);
+		}
+	}
+}
+
+void MxVideoDecodePool::Shutdown()
+{
+	delete g_videoDecodePool;
+	g_videoDecodePool = NULL;
+	g_videoDecodePoolFailed = FALSE;
+}
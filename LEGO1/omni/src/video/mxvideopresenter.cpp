@@ -96,6 +96,7 @@ void MxVideoPresenter::Init()
 	m_frameLoadTickleCount = 1;
 	m_surface = NULL;
 	m_frozenTime = -1;
+	m_decodeQueue = NULL;
 	SetLoadedFirstFrame(FALSE);
 
 	if (MVideoManager() != NULL) {
@@ -111,6 +112,8 @@ void MxVideoPresenter::Init()
 // FUNCTION: LEGO1 0x100b27b0
 void MxVideoPresenter::Destroy(MxBool p_fromDestructor)
 {
+	StopBackgroundDecode();
+
 	if (MVideoManager() != NULL) {
 		MVideoManager()->UnregisterPresenter(*this);
 	}
@@ -313,6 +316,7 @@ void MxVideoPresenter::StartingTickle()
 
 	if (chunk && m_action->GetElapsedTime() >= chunk->GetTime()) {
 		CreateBitmap();
+		StartBackgroundDecode();
 		ProgressTickleState(e_streaming);
 	}
 }
@@ -320,7 +324,10 @@ void MxVideoPresenter::StartingTickle()
 // FUNCTION: LEGO1 0x100b2fe0
 void MxVideoPresenter::StreamingTickle()
 {
-	if (m_action->GetFlags() & MxDSAction::c_bit10) {
+	if (m_decodeQueue) {
+		BackgroundStreamingTickle();
+	}
+	else if (m_action->GetFlags() & MxDSAction::c_bit10) {
 		if (!m_currentChunk) {
 			MxMediaPresenter::StreamingTickle();
 		}
@@ -360,6 +367,104 @@ void MxVideoPresenter::StreamingTickle()
 	}
 }
 
+void MxVideoPresenter::StartBackgroundDecode()
+{
+	StopBackgroundDecode();
+
+	// Looping actions replay their chunks synchronously from RepeatingTickle, and c_bit10 chunks are not
+	// timed, so only plain streams are worth decoding ahead.
+	if (SupportsBackgroundDecode() && !(m_action->GetFlags() & (MxDSAction::c_looping | MxDSAction::c_bit10))) {
+		m_decodeQueue = MxVideoDecodeQueue::Create(this, m_frameBitmap);
+	}
+}
+
+void MxVideoPresenter::StopBackgroundDecode()
+{
+	if (m_decodeQueue) {
+		m_decodeQueue->Cancel();
+
+		MxVideoDecodeQueue::Frame* frame;
+		while ((frame = m_decodeQueue->Front())) {
+			if (m_subscriber) {
+				m_subscriber->FreeDataChunk(frame->m_chunk);
+			}
+
+			m_decodeQueue->Pop();
+		}
+
+		delete m_decodeQueue;
+		m_decodeQueue = NULL;
+	}
+}
+
+// Keeps the decode queue topped up with upcoming chunks and flips to the newest decoded frame that is due.
+// Older frames that became due in the same tickle are dropped; a due frame that is still decoding is late
+// and holds back presentation until a later tickle.
+void MxVideoPresenter::BackgroundStreamingTickle()
+{
+	MxLong elapsed = m_action->GetElapsedTime();
+
+	while (!m_decodeQueue->IsFull()) {
+		if (!m_currentChunk) {
+			MxStreamChunk* chunk = CurrentChunk();
+
+			// Let queued frames play out before the end of the stream moves us on to e_repeating
+			if (!chunk || (chunk->GetChunkFlags() & DS_CHUNK_END_OF_STREAM && !m_decodeQueue->IsEmpty())) {
+				break;
+			}
+
+			MxMediaPresenter::StreamingTickle();
+
+			if (!m_currentChunk) {
+				break;
+			}
+		}
+
+		m_decodeQueue->Submit(m_currentChunk);
+		m_currentChunk = NULL;
+	}
+
+	if (m_currentTickleState != e_streaming) {
+		return;
+	}
+
+	MxVideoDecodeQueue::Frame* frame;
+	MxU32 presented = 0;
+	MxBool paletteChanged = FALSE;
+
+	while ((frame = m_decodeQueue->Front()) && elapsed >= frame->m_chunk->GetTime()) {
+		if (!m_decodeQueue->IsDecoded(frame)) {
+			m_decodeQueue->CountLate(frame);
+			break;
+		}
+
+		MxBitmap* bitmap = m_frameBitmap;
+		m_frameBitmap = frame->m_bitmap;
+		frame->m_bitmap = bitmap;
+		paletteChanged |= frame->m_paletteChanged;
+
+		for (size_t i = 0; i < frame->m_rects.size(); i++) {
+			MxRect32 rect = frame->m_rects[i];
+			rect += m_location;
+			MVideoManager()->InvalidateRect(rect);
+		}
+
+		m_subscriber->FreeDataChunk(frame->m_chunk);
+		m_decodeQueue->Pop();
+		presented++;
+	}
+
+	if (presented) {
+		m_decodeQueue->CountPresented(presented);
+
+		if (((MxDSMediaAction*) m_action)->GetPaletteManagement() && paletteChanged) {
+			RealizePalette();
+		}
+
+		SetLoadedFirstFrame(TRUE);
+	}
+}
+
 // FUNCTION: LEGO1 0x100b3080
 void MxVideoPresenter::RepeatingTickle()
 {
@@ -443,6 +548,8 @@ MxResult MxVideoPresenter::AddToManager()
 void MxVideoPresenter::EndAction()
 {
 	if (m_action) {
+		// Queued chunks have to go back to the subscriber before it is deleted
+		StopBackgroundDecode();
 		MxMediaPresenter::EndAction();
 		AUTOLOCK(m_criticalSection);
 
@@ -2,6 +2,7 @@
 #define MATRIX4D_H
 
 #include "matrix.h"
+#include "simd.h"
 
 #include <math.h>
 #include <memory.h>
@@ -120,6 +121,9 @@ void Matrix4::SetTranslation(const float& p_x, const float& p_y, const float& p_
 // FUNCTION: BETA10 0x100100a0
 void Matrix4::Product(float (*p_a)[4], float (*p_b)[4])
 {
+#ifdef REALTIME_SIMD
+	SimdMatrixProduct((float*) m_data, (const float*) p_a, (const float*) p_b);
+#else
 	float* cur = (float*) m_data;
 
 	for (int row = 0; row < 4; row++) {
@@ -131,6 +135,7 @@ void Matrix4::Product(float (*p_a)[4], float (*p_b)[4])
 			cur++;
 		}
 	}
+#endif
 }
 
 // FUNCTION: LEGO1 0x10002530
@@ -319,6 +324,19 @@ int Matrix4::Invert(Matrix4& p_mat)
 		}
 
 		float pivotValue = copy[i][i];
+
+#ifdef REALTIME_SIMD
+		SimdRowDivide(p_mat[i], pivotValue);
+		SimdRowDivide(copy[i], pivotValue);
+
+		for (column = 0; column < 4; column++) {
+			if (i != column) {
+				float factor = copy[column][i];
+				SimdRowSubtractScaled(p_mat[column], p_mat[i], factor);
+				SimdRowSubtractScaled(copy[column], copy[i], factor);
+			}
+		}
+#else
 		int k;
 
 		for (k = 0; k < 4; k++) {
@@ -350,6 +368,7 @@ int Matrix4::Invert(Matrix4& p_mat)
 				}
 			}
 		}
+#endif
 	}
 
 	// SUCCESS from mxtypes.h
@@ -0,0 +1,110 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// SSE/NEON kernels for the realtime matrix and vector routines. Each output row is built as a running sum of
+// scaled matrix rows, so every element sees the same multiplies and adds in the same order as the scalar loops;
+// the only difference is that a product of -0 is not turned into +0 by the scalar code's 0.0f initial value.
+// Define ISLE_SCALAR_MATH to compile the original scalar code instead, e.g. to validate results against it.
+
+#if !defined(ISLE_SCALAR_MATH) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define REALTIME_SSE
+#define REALTIME_SIMD
+#elif !defined(ISLE_SCALAR_MATH) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define REALTIME_NEON
+#define REALTIME_SIMD
+#endif
+
+#ifdef REALTIME_SIMD
+
+// p_out = p_a * p_b for row-major 4x4 matrices. p_out may alias p_a or p_b.
+inline void SimdMatrixProduct(float* p_out, const float* p_a, const float* p_b)
+{
+#ifdef REALTIME_SSE
+	__m128 b0 = _mm_loadu_ps(p_b);
+	__m128 b1 = _mm_loadu_ps(p_b + 4);
+	__m128 b2 = _mm_loadu_ps(p_b + 8);
+	__m128 b3 = _mm_loadu_ps(p_b + 12);
+	__m128 rows[4];
+
+	for (int row = 0; row < 4; row++) {
+		const float* a = p_a + row * 4;
+		__m128 r = _mm_mul_ps(_mm_set1_ps(a[0]), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[1]), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+		rows[row] = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[3]), b3));
+	}
+
+	for (int row = 0; row < 4; row++) {
+		_mm_storeu_ps(p_out + row * 4, rows[row]);
+	}
+#else
+	float32x4_t b0 = vld1q_f32(p_b);
+	float32x4_t b1 = vld1q_f32(p_b + 4);
+	float32x4_t b2 = vld1q_f32(p_b + 8);
+	float32x4_t b3 = vld1q_f32(p_b + 12);
+	float32x4_t rows[4];
+
+	// Separate multiplies and adds rather than vmlaq, which may be fused and round differently
+	for (int row = 0; row < 4; row++) {
+		const float* a = p_a + row * 4;
+		float32x4_t r = vmulq_n_f32(b0, a[0]);
+		r = vaddq_f32(r, vmulq_n_f32(b1, a[1]));
+		r = vaddq_f32(r, vmulq_n_f32(b2, a[2]));
+		rows[row] = vaddq_f32(r, vmulq_n_f32(b3, a[3]));
+	}
+
+	for (int row = 0; row < 4; row++) {
+		vst1q_f32(p_out + row * 4, rows[row]);
+	}
+#endif
+}
+
+// p_out = p_vec * p_mat for a row-major 4x4 matrix. p_out may alias p_vec.
+inline void SimdVectorMatrixProduct(float* p_out, const float* p_vec, const float* p_mat)
+{
+#ifdef REALTIME_SSE
+	__m128 r = _mm_mul_ps(_mm_set1_ps(p_vec[0]), _mm_loadu_ps(p_mat));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p_vec[1]), _mm_loadu_ps(p_mat + 4)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p_vec[2]), _mm_loadu_ps(p_mat + 8)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p_vec[3]), _mm_loadu_ps(p_mat + 12)));
+	_mm_storeu_ps(p_out, r);
+#else
+	float32x4_t r = vmulq_n_f32(vld1q_f32(p_mat), p_vec[0]);
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(p_mat + 4), p_vec[1]));
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(p_mat + 8), p_vec[2]));
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(p_mat + 12), p_vec[3]));
+	vst1q_f32(p_out, r);
+#endif
+}
+
+// p_row[k] /= p_value for a row of four
+inline void SimdRowDivide(float* p_row, float p_value)
+{
+#ifdef REALTIME_SSE
+	_mm_storeu_ps(p_row, _mm_div_ps(_mm_loadu_ps(p_row), _mm_set1_ps(p_value)));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	vst1q_f32(p_row, vdivq_f32(vld1q_f32(p_row), vdupq_n_f32(p_value)));
+#else
+	// 32-bit NEON only has a reciprocal estimate, which would not match the scalar division
+	for (int k = 0; k < 4; k++) {
+		p_row[k] /= p_value;
+	}
+#endif
+}
+
+// p_row[k] -= p_src[k] * p_factor for a row of four
+inline void SimdRowSubtractScaled(float* p_row, const float* p_src, float p_factor)
+{
+#ifdef REALTIME_SSE
+	__m128 scaled = _mm_mul_ps(_mm_loadu_ps(p_src), _mm_set1_ps(p_factor));
+	_mm_storeu_ps(p_row, _mm_sub_ps(_mm_loadu_ps(p_row), scaled));
+#else
+	vst1q_f32(p_row, vsubq_f32(vld1q_f32(p_row), vmulq_n_f32(vld1q_f32(p_src), p_factor)));
+#endif
+}
+
+#endif // REALTIME_SIMD
+
+#endif // SIMD_H
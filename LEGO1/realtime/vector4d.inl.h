@@ -1,6 +1,7 @@
 #ifndef VECTOR4D_H
 #define VECTOR4D_H
 
+#include "simd.h"
 #include "vector.h"
 
 #include <math.h>
@@ -74,10 +75,14 @@ void Vector4::EqualsImpl(const float* p_data)
 // FUNCTION: BETA10 0x10048800
 void Vector4::SetMatrixProduct(const float* p_vec, const float* p_mat)
 {
+#ifdef REALTIME_SIMD
+	SimdVectorMatrixProduct(m_data, p_vec, p_mat);
+#else
 	m_data[0] = p_vec[0] * p_mat[0] + p_vec[1] * p_mat[4] + p_vec[2] * p_mat[8] + p_vec[3] * p_mat[12];
 	m_data[1] = p_vec[0] * p_mat[1] + p_vec[1] * p_mat[5] + p_vec[2] * p_mat[9] + p_vec[3] * p_mat[13];
 	m_data[2] = p_vec[0] * p_mat[2] + p_vec[1] * p_mat[6] + p_vec[2] * p_mat[10] + p_vec[3] * p_mat[14];
 	m_data[3] = p_vec[0] * p_mat[3] + p_vec[1] * p_mat[7] + p_vec[2] * p_mat[11] + p_vec[3] * p_mat[15];
+#endif
 }
 
 // FUNCTION: LEGO1 0x10002ae0
@@ -6,7 +6,7 @@
 
 #include <vec.h>
 
-DECOMP_SIZE_ASSERT(ViewManager, 0x1bc)
+DECOMP_SIZE_ASSERT(ViewManager, 0x1d4)
 
 // GLOBAL: LEGO1 0x100dbc78
 // GLOBAL: BETA10 0x101c3398
@@ -34,6 +34,10 @@ float g_viewDistance = 0.000125F;
 // GLOBAL: LEGO1 0x10101060
 float g_elapsedSeconds = 0;
 
+// A ROI only switches LOD, or reappears after being culled as too small, once its projected size has moved past
+// the threshold by this factor, so ROIs hovering around a threshold do not flip every frame
+float g_lodHysteresis = 1.2F;
+
 inline void SetAppData(ViewROI* p_roi, LPD3DRM_APPDATA data);
 inline undefined4 GetD3DRM_viewmanager(IDirect3DRM2*& d3drm, Tgl::Renderer* pRenderer);
 inline undefined4 GetFrame(IDirect3DRMFrame2** frame, Tgl::Group* scene);
@@ -57,6 +61,8 @@ ViewManager::ViewManager(Tgl::Renderer* pRenderer, Tgl::Group* scene, const Orie
 
 	memset(transformed_points, 0, sizeof(transformed_points));
 	seconds_allowed = 1.0;
+	evaluated_roi_count = 0;
+	changed_roi_count = 0;
 }
 
 // FUNCTION: LEGO1 0x100a60c0
@@ -227,12 +233,16 @@ void ViewManager::RemoveROIDetailFromScene(ViewROI* p_roi)
 
 // FUNCTION: LEGO1 0x100a66f0
 // FUNCTION: BETA10 0x1017297f
-inline void ViewManager::ManageVisibilityAndDetailRecursively(ViewROI* p_from, int p_lodLevel)
+// Records the visibility and detail decisions for p_from and its children without touching the scene.
+// Besides the decision list it only writes each ROI's own LOD decision, so top-level ROIs could be evaluated
+// on separate workers into separate lists.
+inline void ViewManager::EvaluateVisibilityAndDetail(ViewROI* p_from, int p_lodLevel)
 {
 	assert(p_from);
 
 	if (!p_from->GetVisibility() && p_lodLevel != ViewROI::c_lodLevelInvisible) {
-		ManageVisibilityAndDetailRecursively(p_from, ViewROI::c_lodLevelInvisible);
+		p_from->SetLodDecision(ViewROI::c_lodLevelUnset);
+		EvaluateVisibilityAndDetail(p_from, ViewROI::c_lodLevelInvisible);
 	}
 	else {
 		const CompoundObject* comp = p_from->GetComp();
@@ -242,49 +252,111 @@ inline void ViewManager::ManageVisibilityAndDetailRecursively(ViewROI* p_from, i
 			// issues where 0.001 sentinel radius compares as > 0.001F on x87.
 			if (p_from->GetWorldBoundingSphere().Radius() > 0.002F) {
 				float projectedSize = ProjectedSize(p_from->GetWorldBoundingSphere());
+				int previous = p_from->GetLodDecision();
+				float cullSize = seconds_allowed * g_viewDistance;
+
+				if (previous == ViewROI::c_lodLevelInvisible) {
+					cullSize *= g_lodHysteresis;
+				}
+
+				if (RealtimeView::GetUserMaxLOD() <= 5.0f && projectedSize < cullSize) {
+					p_from->SetLodDecision(ViewROI::c_lodLevelInvisible);
 
-				if (RealtimeView::GetUserMaxLOD() <= 5.0f && projectedSize < seconds_allowed * g_viewDistance) {
 					if (p_from->GetLodLevel() != ViewROI::c_lodLevelInvisible) {
-						ManageVisibilityAndDetailRecursively(p_from, ViewROI::c_lodLevelInvisible);
+						EvaluateVisibilityAndDetail(p_from, ViewROI::c_lodLevelInvisible);
+					}
+					else {
+						// Already hidden, nothing to record
+						evaluated_roi_count++;
 					}
 
 					return;
 				}
 				else {
-					p_lodLevel =
-						CalculateLODLevel(projectedSize, RealtimeView::GetUserMaxLodPower() * seconds_allowed, p_from);
+					float initialScale = RealtimeView::GetUserMaxLodPower() * seconds_allowed;
+					p_lodLevel = CalculateLODLevel(projectedSize, initialScale, p_from);
+
+					if (previous >= 0 && p_lodLevel != previous) {
+						// Only leave the previous level if it still differs with the size moved back by the margin
+						if (p_lodLevel > previous) {
+							int damped = CalculateLODLevel(projectedSize / g_lodHysteresis, initialScale, p_from);
+							p_lodLevel = damped > previous ? damped : previous;
+						}
+						else {
+							int damped = CalculateLODLevel(projectedSize * g_lodHysteresis, initialScale, p_from);
+							p_lodLevel = damped < previous ? damped : previous;
+						}
+					}
+
+					p_from->SetLodDecision(p_lodLevel);
 				}
 			}
 		}
 
 		if (p_lodLevel == ViewROI::c_lodLevelInvisible) {
-			if (p_from->GetLodLevel() >= 0) {
-				RemoveROIDetailFromScene(p_from);
-				p_from->SetLodLevel(ViewROI::c_lodLevelInvisible);
-			}
+			ViewROIDecision decision = {p_from, ViewROIDecision::c_hide, p_lodLevel, p_from->GetLodLevel() >= 0};
+			decisions.push_back(decision);
 
 			if (comp != NULL) {
 				for (CompoundObject::const_iterator it = comp->begin(); it != comp->end(); it++) {
-					ManageVisibilityAndDetailRecursively((ViewROI*) *it, p_lodLevel);
+					EvaluateVisibilityAndDetail((ViewROI*) *it, p_lodLevel);
 				}
 			}
 		}
 		else if (comp == NULL) {
 			if (p_from->GetLODs() != NULL && p_from->GetLODCount() > 0) {
-				UpdateROIDetailBasedOnLOD(p_from, p_lodLevel);
+				int lodLevel = p_lodLevel < p_from->GetLODCount() ? p_lodLevel : p_from->GetLODCount() - 1;
+				ViewROIDecision decision =
+					{p_from, ViewROIDecision::c_showLOD, p_lodLevel, lodLevel != p_from->GetLodLevel()};
+				decisions.push_back(decision);
 			}
 		}
 		else {
-			p_from->SetLodLevel(ViewROI::c_lodLevelUnset);
+			ViewROIDecision decision = {
+				p_from,
+				ViewROIDecision::c_unset,
+				ViewROI::c_lodLevelUnset,
+				p_from->GetLodLevel() != ViewROI::c_lodLevelUnset
+			};
+			decisions.push_back(decision);
 
 			for (CompoundObject::const_iterator it = comp->begin(); it != comp->end(); it++) {
 				// LINE: BETA10 0x10172bbd
-				ManageVisibilityAndDetailRecursively((ViewROI*) *it, p_lodLevel);
+				EvaluateVisibilityAndDetail((ViewROI*) *it, p_lodLevel);
 			}
 		}
 	}
 }
 
+// Applies the decisions recorded by EvaluateVisibilityAndDetail in evaluation order, skipping unchanged ROIs
+inline void ViewManager::ApplyVisibilityAndDetail()
+{
+	for (size_t i = 0; i < decisions.size(); i++) {
+		const ViewROIDecision& decision = decisions[i];
+
+		if (!decision.m_changed) {
+			continue;
+		}
+
+		switch (decision.m_action) {
+		case ViewROIDecision::c_hide:
+			RemoveROIDetailFromScene(decision.m_roi);
+			decision.m_roi->SetLodLevel(ViewROI::c_lodLevelInvisible);
+			changed_roi_count++;
+			break;
+		case ViewROIDecision::c_showLOD:
+			UpdateROIDetailBasedOnLOD(decision.m_roi, decision.m_lodLevel);
+			changed_roi_count++;
+			break;
+		case ViewROIDecision::c_unset:
+			decision.m_roi->SetLodLevel(ViewROI::c_lodLevelUnset);
+			break;
+		}
+	}
+
+	decisions.clear();
+}
+
 // FUNCTION: LEGO1 0x100a6930
 void ViewManager::Update(float p_previousRenderTime, float)
 {
@@ -301,10 +373,18 @@ void ViewManager::Update(float p_previousRenderTime, float)
 		UpdateViewTransformations();
 	}
 
+	ViewROI::UpdateGeometryTransformations();
+
+	evaluated_roi_count = 0;
+	changed_roi_count = 0;
+
 	for (CompoundObject::iterator it = rois.begin(); it != rois.end(); it++) {
-		ManageVisibilityAndDetailRecursively((ViewROI*) *it, ViewROI::c_lodLevelUnset);
+		EvaluateVisibilityAndDetail((ViewROI*) *it, ViewROI::c_lodLevelUnset);
 	}
 
+	evaluated_roi_count += (unsigned int) decisions.size();
+	ApplyVisibilityAndDetail();
+
 	stopWatch.Stop();
 	g_elapsedSeconds = stopWatch.ElapsedSeconds();
 }
@@ -517,6 +597,9 @@ ViewROI* ViewManager::Pick(Tgl::View* p_view, int x, int y)
 	TglImpl::ViewImpl* view = (TglImpl::ViewImpl*) p_view;
 	IDirect3DRMViewport* d3drm = view->ImplementationData();
 
+	// Picking hits the renderer's frames, which must reflect ROIs moved since the last render
+	ViewROI::UpdateGeometryTransformations();
+
 	if (d3drm->Pick(x, y, &picked) != D3DRM_OK) {
 		return NULL;
 	}
@@ -6,15 +6,31 @@
 #include "realtime/realtimeview.h"
 #include "viewroi.h"
 
+#include <vector>
+
 #ifdef MINIWIN
 #include "miniwin/d3drm.h"
 #else
 #include <d3drm.h>
 #endif
 
+// Visibility and detail change for one ROI, computed for all ROIs before any of them is applied to the scene
+struct ViewROIDecision {
+	enum Action {
+		c_hide,    // Remove the ROI's detail from the scene
+		c_showLOD, // Show a leaf ROI at m_lodLevel
+		c_unset    // Compound ROI whose detail lives in its children
+	};
+
+	ViewROI* m_roi;
+	int m_action;
+	int m_lodLevel;
+	bool m_changed;
+};
+
 // VTABLE: LEGO1 0x100dbd88
 // VTABLE: BETA10 0x101c34bc
-// SIZE 0x1bc
+// SIZE 0x1d4
 class ViewManager {
 public:
 	enum Flags {
@@ -37,7 +53,8 @@ class ViewManager {
 	ViewROI* Pick(Tgl::View* p_view, int x, int y);
 	void SetResolution(int width, int height);
 	void SetFrustrum(float fov, float front, float back);
-	inline void ManageVisibilityAndDetailRecursively(ViewROI* p_from, int p_lodLevel);
+	inline void EvaluateVisibilityAndDetail(ViewROI* p_from, int p_lodLevel);
+	inline void ApplyVisibilityAndDetail();
 	void Update(float p_previousRenderTime, float);
 	inline int CalculateFrustumTransformations();
 	void UpdateViewTransformations();
@@ -51,6 +68,10 @@ class ViewManager {
 	// FUNCTION: BETA10 0x100e1260
 	void Add(ViewROI* p_roi) { rois.push_back(p_roi); }
 
+	// ROIs evaluated and ROIs whose visibility or LOD changed during the last Update()
+	unsigned int GetEvaluatedROICount() const { return evaluated_roi_count; }
+	unsigned int GetChangedROICount() const { return changed_roi_count; }
+
 	// SYNTHETIC: LEGO1 0x100a6000
 	// SYNTHETIC: BETA10 0x10174410
 	// ViewManager::`scalar deleting destructor'
@@ -75,6 +96,11 @@ class ViewManager {
 	IDirect3DRM2* d3drm;            // 0x1b0
 	IDirect3DRMFrame2* frame;       // 0x1b4
 	float seconds_allowed;          // 0x1b8
+
+	// Reused between updates
+	std::vector<ViewROIDecision> decisions; // 0x1bc
+	unsigned int evaluated_roi_count;       // 0x1cc
+	unsigned int changed_roi_count;         // 0x1d0
 };
 
 // TEMPLATE: LEGO1 0x10022030
@@ -3,12 +3,16 @@
 #include "decomp.h"
 
 #include <vec.h>
+#include <vector>
 
-DECOMP_SIZE_ASSERT(ViewROI, 0xe4)
+DECOMP_SIZE_ASSERT(ViewROI, 0xec)
 
 // GLOBAL: LEGO1 0x101013d8
 unsigned char g_lightSupport = FALSE;
 
+// ROIs whose world transform changed since the geometry was last updated
+static std::vector<ViewROI*> g_pendingGeometryROIs;
+
 // FUNCTION: LEGO1 0x100a9eb0
 float ViewROI::IntrinsicImportance() const
 {
@@ -40,6 +44,16 @@ void ViewROI::UpdateWorldDataWithTransformAndChildren(const Matrix4& parent2worl
 // FUNCTION: BETA10 0x1018c7b0
 inline void ViewROI::SetGeometryTransformation()
 {
+	if (geometry && !m_geometryTransformationPending) {
+		m_geometryTransformationPending = true;
+		g_pendingGeometryROIs.push_back(this);
+	}
+}
+
+void ViewROI::ApplyGeometryTransformation()
+{
+	m_geometryTransformationPending = false;
+
 	if (geometry) {
 		Tgl::FloatMatrix4 matrix;
 		Matrix4 in(matrix);
@@ -48,6 +62,31 @@ inline void ViewROI::SetGeometryTransformation()
 	}
 }
 
+void ViewROI::CancelGeometryTransformation()
+{
+	if (m_geometryTransformationPending) {
+		for (size_t i = 0; i < g_pendingGeometryROIs.size(); i++) {
+			if (g_pendingGeometryROIs[i] == this) {
+				g_pendingGeometryROIs[i] = NULL;
+				break;
+			}
+		}
+
+		m_geometryTransformationPending = false;
+	}
+}
+
+void ViewROI::UpdateGeometryTransformations()
+{
+	for (size_t i = 0; i < g_pendingGeometryROIs.size(); i++) {
+		if (g_pendingGeometryROIs[i] != NULL) {
+			g_pendingGeometryROIs[i]->ApplyGeometryTransformation();
+		}
+	}
+
+	g_pendingGeometryROIs.clear();
+}
+
 // FUNCTION: LEGO1 0x100a9fc0
 // FUNCTION: BETA10 0x1018cad0
 void ViewROI::UpdateWorldDataWithTransform(const Matrix4& p_transform)
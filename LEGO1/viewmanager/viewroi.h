@@ -14,7 +14,7 @@
 
 // VTABLE: LEGO1 0x100dbe70
 // VTABLE: BETA10 0x101c3908
-// SIZE 0xe4
+// SIZE 0xec
 class ViewROI : public OrientableROI {
 public:
 	enum {
@@ -28,12 +28,16 @@ class ViewROI : public OrientableROI {
 		SetLODList(lodList);
 		geometry = pRenderer->CreateGroup();
 		m_lodLevel = c_lodLevelUnset;
+		m_lodDecision = c_lodLevelUnset;
+		m_geometryTransformationPending = false;
 	}
 
 	// FUNCTION: LEGO1 0x100a9e20
 	// FUNCTION: BETA10 0x1018c680
 	~ViewROI() override
 	{
+		CancelGeometryTransformation();
+
 		// SetLODList() will decrease refCount of LODList
 		SetLODList(0);
 		delete geometry;
@@ -67,16 +71,32 @@ class ViewROI : public OrientableROI {
 
 	int GetLodLevel() { return m_lodLevel; }
 	void SetLodLevel(int p_lodLevel) { m_lodLevel = p_lodLevel; }
+	int GetLodDecision() { return m_lodDecision; }
+	void SetLodDecision(int p_lodDecision) { m_lodDecision = p_lodDecision; }
 
 	static unsigned char SetLightSupport(unsigned char p_lightSupport);
 
+	// Hands the world transforms of all ROIs moved since the last call to their geometry. ROIs often move
+	// several times per frame (animation, then path correction, then attached parts), so the renderer is only
+	// told about the final transform, once per frame, before the view manager culls and renders the scene.
+	static void UpdateGeometryTransformations();
+
 protected:
 	void UpdateWorldDataWithTransformAndChildren(const Matrix4& parent2world) override; // vtable+0x28
 
 	void SetGeometryTransformation();
+	void ApplyGeometryTransformation();
+	void CancelGeometryTransformation();
 
 	Tgl::Group* geometry; // 0xdc
 	int m_lodLevel;       // 0xe0
+
+	// Level the view manager last chose from this ROI's projected size (or c_lodLevelInvisible if it was culled
+	// as too small). Compound ROIs keep m_lodLevel unset, so this is what LOD hysteresis compares against.
+	int m_lodDecision; // 0xe4
+
+	// Queued for UpdateGeometryTransformations()
+	bool m_geometryTransformationPending; // 0xe8
 };
 
 // SYNTHETIC: LEGO1 0x100aa250
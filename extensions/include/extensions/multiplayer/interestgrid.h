@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Multiplayer
+{
+
+// Area-of-interest filtering for player state updates.
+// Players only interest each other while both are in the Isle world; there, the island is divided
+// into square grid cells and interest falls off with the Chebyshev distance between cells.
+// The relay applies the same rules (see server/protocol.ts) and must stay in sync.
+
+static constexpr float INTEREST_CELL_SIZE = 40.0f;
+static constexpr int32_t INTEREST_NEAR_CELLS = 1; // Same or adjacent cell
+static constexpr int32_t INTEREST_FAR_CELLS = 4;
+
+enum InterestLevel : uint8_t {
+	INTEREST_NONE = 0,
+	INTEREST_FAR = 1,
+	INTEREST_NEAR = 2
+};
+
+// Minimum time between two MSG_STATE broadcasts for the best interest level toward any peer.
+// INTEREST_NONE still sends a keep-alive well inside NetworkManager's remote player timeout.
+static constexpr uint32_t STATE_INTERVAL_NEAR_MS = 66; // ~15Hz
+static constexpr uint32_t STATE_INTERVAL_FAR_MS = 200; // 5Hz
+static constexpr uint32_t STATE_INTERVAL_NONE_MS = 1000;
+
+struct InterestCell {
+	int32_t m_x;
+	int32_t m_z;
+};
+
+InterestCell ComputeInterestCell(float p_x, float p_z);
+
+// p_posA/p_posB are world positions (x, y, z); only x and z are used.
+InterestLevel ComputeInterest(int8_t p_worldA, const float* p_posA, int8_t p_worldB, const float* p_posB);
+
+uint32_t GetStateInterval(InterestLevel p_level);
+
+} // namespace Multiplayer
@@ -5,6 +5,7 @@
 #include "extensions/multiplayer/animation/locationproximity.h"
 #include "extensions/multiplayer/animation/sceneplayer.h"
 #include "extensions/multiplayer/animation/sessionhost.h"
+#include "extensions/multiplayer/interestgrid.h"
 #include "extensions/multiplayer/networktransport.h"
 #include "extensions/multiplayer/platformcallbacks.h"
 #include "extensions/multiplayer/protocol.h"
@@ -120,6 +121,7 @@ class NetworkManager : public MxCore {
 
 private:
 	void BroadcastLocalState();
+	InterestLevel ComputeBestInterest(const PlayerStateMsg& p_localState) const;
 	void ProcessIncomingPackets();
 	void UpdateRemotePlayers(float p_deltaTime);
 
@@ -181,6 +183,8 @@ class NetworkManager : public MxCore {
 	uint32_t m_hostPeerId;
 	uint32_t m_sequence;
 	uint32_t m_lastBroadcastTime;
+	uint32_t m_lastStateSendTime;
+	PlayerStateMsg m_lastSentState;
 	uint8_t m_lastValidActorId;
 	bool m_localAllowRemoteCustomize;
 	bool m_inIsleWorld;
@@ -241,7 +245,7 @@ class NetworkManager : public MxCore {
 	uint32_t m_reconnectDelay;
 	uint32_t m_nextReconnectTime;
 
-	static const uint32_t BROADCAST_INTERVAL_MS = 66; // ~15Hz
+	static const uint32_t BROADCAST_INTERVAL_MS = 66; // ~15Hz, local state is evaluated at this rate
 	static const uint32_t TIMEOUT_MS = 5000;          // 5 second timeout
 	static const uint32_t RECONNECT_INITIAL_DELAY_MS = 1000;
 	static const uint32_t RECONNECT_MAX_DELAY_MS = 30000;
@@ -3,11 +3,10 @@
 #ifndef __EMSCRIPTEN__
 
 #include "extensions/multiplayer/networktransport.h"
-#include "mxcriticalsection.h"
+#include "mxspscqueue.h"
 #include "mxthread.h"
 
 #include <atomic>
-#include <deque>
 #include <string>
 #include <vector>
 
@@ -49,6 +48,8 @@ class LwsTransport : public NetworkTransport {
 
 private:
 	void ServiceLoop();
+	bool PushReceived();
+	size_t CoalesceOutgoing();
 
 	std::string m_relayBaseUrl;
 	struct lws_context* m_context;
@@ -57,11 +58,16 @@ class LwsTransport : public NetworkTransport {
 	std::atomic<bool> m_disconnected;
 	std::atomic<bool> m_wasEverConnected;
 
-	MxCriticalSection m_sendCS;
-	MxCriticalSection m_recvCS;
-	std::deque<std::vector<uint8_t>> m_sendQueue;
-	std::deque<std::vector<uint8_t>> m_recvQueue;
+	// Game thread -> service thread. Slots are reused, so sending does not allocate once warmed up.
+	MxSpscQueue<std::vector<uint8_t>> m_sendQueue;
+
+	// Service thread -> game thread. Completed frames are swapped in from m_fragment.
+	MxSpscQueue<std::vector<uint8_t>> m_recvQueue;
+
+	// Service thread only
 	std::vector<uint8_t> m_fragment;
+	std::vector<uint8_t> m_writeBuffer;
+	std::atomic<bool> m_rxPaused;
 
 	LwsServiceThread* m_serviceThread;
 	std::atomic<bool> m_wantWritable;
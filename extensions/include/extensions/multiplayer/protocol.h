@@ -33,6 +33,7 @@ enum MessageType : uint8_t {
 	MSG_ANIM_UPDATE = 13,
 	MSG_ANIM_START = 14,
 	MSG_HORN = 16,
+	MSG_BATCH = 17,
 	MSG_ASSIGN_ID = 0xFF
 };
 
@@ -201,6 +202,11 @@ struct AnimStartMsg {
 
 #pragma pack(pop)
 
+// MSG_BATCH frame layout (client -> relay only): the type byte, followed by any number of
+// [uint16_t length][message bytes] records. The relay unpacks and routes each record on its own,
+// so receivers never see batch frames.
+static constexpr size_t BATCH_LENGTH_PREFIX_SIZE = sizeof(uint16_t);
+
 // Bitmask constants for PlayerStateMsg::customizeFlags
 static constexpr uint8_t CUSTOMIZE_FLAG_ALLOW_REMOTE = 0x01;
 static constexpr uint8_t CUSTOMIZE_FLAG_FROZEN = 0x02;
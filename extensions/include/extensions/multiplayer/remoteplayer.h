@@ -80,6 +80,7 @@ class RemotePlayer {
 private:
 	bool IsEffectivelyMoving() const;
 	const char* GetDisplayActorName() const;
+	void ApplyAppearance(const PlayerStateMsg& p_msg);
 	void UpdateTransform(float p_deltaTime);
 	void UpdateVehicleState();
 	void EnterVehicle(int8_t p_vehicleType);
@@ -105,6 +106,10 @@ class RemotePlayer {
 	bool m_hasReceivedUpdate;
 	std::vector<int16_t> m_locations;
 
+	// Latest appearance received while hidden, applied in SetVisible(true)
+	PlayerStateMsg m_deferredState;
+	bool m_hasDeferredState;
+
 	float m_currentPosition[3];
 	float m_currentDirection[3];
 	float m_currentUp[3];
@@ -107,6 +107,7 @@ bool CharacterCustomizer::SwitchColor(
 
 	LegoFloat red, green, blue, alpha;
 	LegoROI::GetRGBAColor(part.m_names[part.m_nameIndices[p_state.colorIndices[p_partIndex]]], red, green, blue, alpha);
+	CharacterManager()->UnsharePartLODs(targetROI);
 	targetROI->SetLodColor(red, green, blue, alpha);
 	return true;
 }
@@ -228,6 +229,7 @@ void CharacterCustomizer::ApplyFullState(LegoROI* p_rootROI, uint8_t p_actorInfo
 			blue,
 			alpha
 		);
+		CharacterManager()->UnsharePartLODs(childROI);
 		childROI->SetLodColor(red, green, blue, alpha);
 	}
 
@@ -0,0 +1,50 @@
+#include "extensions/multiplayer/interestgrid.h"
+
+#include "legomain.h"
+
+#include <SDL3/SDL_stdinc.h>
+
+namespace Multiplayer
+{
+
+InterestCell ComputeInterestCell(float p_x, float p_z)
+{
+	InterestCell cell;
+	cell.m_x = (int32_t) SDL_floorf(p_x / INTEREST_CELL_SIZE);
+	cell.m_z = (int32_t) SDL_floorf(p_z / INTEREST_CELL_SIZE);
+	return cell;
+}
+
+InterestLevel ComputeInterest(int8_t p_worldA, const float* p_posA, int8_t p_worldB, const float* p_posB)
+{
+	// Remote players are only ever shown in the Isle world.
+	if (p_worldA != (int8_t) LegoOmni::e_act1 || p_worldB != (int8_t) LegoOmni::e_act1) {
+		return INTEREST_NONE;
+	}
+
+	InterestCell a = ComputeInterestCell(p_posA[0], p_posA[2]);
+	InterestCell b = ComputeInterestCell(p_posB[0], p_posB[2]);
+	int32_t distance = SDL_max(SDL_abs(a.m_x - b.m_x), SDL_abs(a.m_z - b.m_z));
+
+	if (distance <= INTEREST_NEAR_CELLS) {
+		return INTEREST_NEAR;
+	}
+	if (distance <= INTEREST_FAR_CELLS) {
+		return INTEREST_FAR;
+	}
+	return INTEREST_NONE;
+}
+
+uint32_t GetStateInterval(InterestLevel p_level)
+{
+	switch (p_level) {
+	case INTEREST_NEAR:
+		return STATE_INTERVAL_NEAR_MS;
+	case INTEREST_FAR:
+		return STATE_INTERVAL_FAR_MS;
+	default:
+		return STATE_INTERVAL_NONE_MS;
+	}
+}
+
+} // namespace Multiplayer
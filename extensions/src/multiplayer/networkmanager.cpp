@@ -60,7 +60,8 @@ void NetworkManager::SendMessage(const T& p_msg)
 
 NetworkManager::NetworkManager()
 	: m_transport(nullptr), m_callbacks(nullptr), m_localNameBubble(nullptr), m_localPeerId(0), m_hostPeerId(0),
-	  m_sequence(0), m_lastBroadcastTime(0), m_lastValidActorId(0), m_localAllowRemoteCustomize(true),
+	  m_sequence(0), m_lastBroadcastTime(0), m_lastStateSendTime(0), m_lastSentState{}, m_lastValidActorId(0),
+	  m_localAllowRemoteCustomize(true),
 	  m_inIsleWorld(false), m_registered(false), m_pendingToggleThirdPerson(false), m_pendingToggleNameBubbles(false),
 	  m_pendingWalkAnim(-1), m_pendingIdleAnim(-1), m_pendingEmote(-1), m_pendingToggleAllowCustomize(false),
 	  m_pendingAnimInterest(-1), m_pendingAnimCancel(false), m_localPendingAnimInterest(-1), m_showNameBubbles(true),
@@ -621,6 +622,7 @@ void NetworkManager::ResetStateAfterReconnect()
 	m_hostPeerId = 0;
 	m_sequence = 0;
 	m_lastBroadcastTime = 0;
+	m_lastStateSendTime = 0;
 	m_worldSync.ResetForReconnect();
 	ResetAnimationState();
 }
@@ -733,6 +735,17 @@ void NetworkManager::ProcessPendingRequests()
 	}
 }
 
+// True if anything other than the transform differs between two state messages,
+// or if the player started or stopped moving.
+static bool StateAppearanceChanged(const PlayerStateMsg& p_a, const PlayerStateMsg& p_b)
+{
+	return (p_a.speed == 0.0f) != (p_b.speed == 0.0f) || p_a.actorId != p_b.actorId || p_a.worldId != p_b.worldId ||
+		   p_a.vehicleType != p_b.vehicleType || p_a.walkAnimId != p_b.walkAnimId || p_a.idleAnimId != p_b.idleAnimId ||
+		   SDL_memcmp(p_a.name, p_b.name, sizeof(p_a.name)) != 0 || p_a.displayActorIndex != p_b.displayActorIndex ||
+		   SDL_memcmp(p_a.customizeData, p_b.customizeData, sizeof(p_a.customizeData)) != 0 ||
+		   p_a.customizeFlags != p_b.customizeFlags;
+}
+
 void NetworkManager::BroadcastLocalState()
 {
 	if (!m_transport) {
@@ -777,7 +790,6 @@ void NetworkManager::BroadcastLocalState()
 	}
 
 	PlayerStateMsg msg{};
-	msg.header = MakeHeader(MSG_STATE, TARGET_BROADCAST);
 	msg.actorId = actorId;
 	msg.worldId = inRestrictedArea ? WORLD_NOT_VISIBLE : (int8_t) currentWorld->GetWorldId();
 	msg.vehicleType = DetectVehicleType(userActor);
@@ -809,9 +821,48 @@ void NetworkManager::BroadcastLocalState()
 
 	msg.customizeFlags |= m_localAllowRemoteCustomize ? CUSTOMIZE_FLAG_ALLOW_REMOTE : 0x00;
 
+	// Appearance changes go out immediately; pure movement is throttled by how close
+	// the nearest interested peer is.
+	uint32_t now = SDL_GetTicks();
+	if (!StateAppearanceChanged(msg, m_lastSentState) &&
+		(now - m_lastStateSendTime) < GetStateInterval(ComputeBestInterest(msg))) {
+		// The host coordinates animations by position and still gets every update
+		if (!IsHost() && m_hostPeerId != 0) {
+			msg.header = MakeHeader(MSG_STATE, TARGET_HOST);
+			SendMessage(msg);
+		}
+		return;
+	}
+
+	msg.header = MakeHeader(MSG_STATE, TARGET_BROADCAST);
+	m_lastSentState = msg;
+	m_lastStateSendTime = now;
 	SendMessage(msg);
 }
 
+InterestLevel NetworkManager::ComputeBestInterest(const PlayerStateMsg& p_localState) const
+{
+	InterestLevel best = INTEREST_NONE;
+
+	for (const auto& [peerId, player] : m_remotePlayers) {
+		// The host is sent every update separately and does not set the broadcast rate
+		if (peerId == m_hostPeerId || !player->HasReceivedUpdate()) {
+			continue;
+		}
+
+		float remotePos[3] = {0.0f, 0.0f, 0.0f};
+		player->GetTargetPosition(remotePos[0], remotePos[2]);
+
+		InterestLevel level =
+			ComputeInterest(p_localState.worldId, p_localState.position, player->GetWorldId(), remotePos);
+		if (level > best) {
+			best = level;
+		}
+	}
+
+	return best;
+}
+
 void NetworkManager::ProcessIncomingPackets()
 {
 	if (!m_transport) {
@@ -1172,18 +1223,6 @@ static const HornVehicleInfo g_hornVehicles[] = {
 
 void NetworkManager::HandleHorn(const HornMsg& p_msg)
 {
-	// Sweep finished horn sounds
-	for (auto it = m_activeHorns.begin(); it != m_activeHorns.end();) {
-		if (!ma_sound_is_playing((*it)->m_cacheSound)) {
-			(*it)->Stop();
-			delete *it;
-			it = m_activeHorns.erase(it);
-		}
-		else {
-			++it;
-		}
-	}
-
 	uint32_t peerId = p_msg.header.peerId;
 	auto it = m_remotePlayers.find(peerId);
 	if (it == m_remotePlayers.end()) {
@@ -1203,12 +1242,42 @@ void NetworkManager::HandleHorn(const HornMsg& p_msg)
 		return;
 	}
 
-	LegoCacheSound* horn = m_hornTemplates[templateIdx]->Clone();
+	LegoCacheSound* hornTemplate = m_hornTemplates[templateIdx];
+	LegoCacheSound* horn = nullptr;
+
+	// Sweep finished horn sounds, keeping one of this vehicle's to replay instead of cloning the template again
+	for (auto hornIt = m_activeHorns.begin(); hornIt != m_activeHorns.end();) {
+		if (!ma_sound_is_playing((*hornIt)->m_cacheSound)) {
+			(*hornIt)->Stop();
+
+			if (!horn && !SDL_strcmp((*hornIt)->GetUnknown0x48().GetData(), hornTemplate->GetUnknown0x48().GetData())) {
+				horn = *hornIt;
+				++hornIt;
+				continue;
+			}
+
+			delete *hornIt;
+			hornIt = m_activeHorns.erase(hornIt);
+		}
+		else {
+			++hornIt;
+		}
+	}
+
 	if (horn) {
-		ma_sound_set_doppler_factor(horn->m_cacheSound, 0);
-		horn->Play(it->second->GetUniqueName(), FALSE);
+		horn->ResetVoice();
+	}
+	else {
+		horn = hornTemplate->Clone();
+		if (!horn) {
+			return;
+		}
+
 		m_activeHorns.push_back(horn);
 	}
+
+	ma_sound_set_doppler_factor(horn->m_cacheSound, 0);
+	horn->Play(it->second->GetUniqueName(), FALSE);
 }
 
 void NetworkManager::PreloadHornSounds()
@@ -2,6 +2,8 @@
 
 #include "extensions/multiplayer/platforms/native/lwstransport.h"
 
+#include "extensions/multiplayer/protocol.h"
+
 #include <SDL3/SDL_log.h>
 #include <SDL3/SDL_stdinc.h>
 #include <libwebsockets.h>
@@ -20,6 +22,11 @@ static int LwsCallback(struct lws* p_wsi, enum lws_callback_reasons p_reason, vo
 
 static constexpr size_t LWS_RX_BUFFER_SIZE = 8192;
 static constexpr int LWS_SERVICE_TIMEOUT_MS = 50;
+static constexpr size_t SEND_QUEUE_CAPACITY = 256;
+static constexpr size_t RECV_QUEUE_CAPACITY = 512;
+
+// Upper bound for a coalesced MSG_BATCH frame; stays below a typical path MTU.
+static constexpr size_t MAX_BATCH_FRAME_SIZE = 1200;
 
 // clang-format off
 static const struct lws_protocols s_protocols[] = {
@@ -38,8 +45,10 @@ MxResult LwsServiceThread::Run()
 
 LwsTransport::LwsTransport(const std::string& p_relayBaseUrl)
 	: m_relayBaseUrl(p_relayBaseUrl), m_context(nullptr), m_wsi(nullptr), m_connected(false), m_disconnected(false),
-	  m_wasEverConnected(false), m_serviceThread(nullptr), m_wantWritable(false)
+	  m_wasEverConnected(false), m_sendQueue(SEND_QUEUE_CAPACITY), m_recvQueue(RECV_QUEUE_CAPACITY),
+	  m_rxPaused(false), m_serviceThread(nullptr), m_wantWritable(false)
 {
+	m_writeBuffer.reserve(LWS_PRE + MAX_BATCH_FRAME_SIZE);
 }
 
 LwsTransport::~LwsTransport()
@@ -146,15 +155,11 @@ void LwsTransport::Disconnect()
 	m_wsi.store(nullptr);
 	m_connected.store(false);
 	m_wantWritable.store(false);
+	m_rxPaused.store(false);
 
-	m_sendCS.Enter();
-	m_sendQueue.clear();
-	m_sendCS.Leave();
-
-	m_recvCS.Enter();
-	m_recvQueue.clear();
-	m_recvCS.Leave();
-
+	// The service thread is gone at this point, so both ends of the queues are ours.
+	m_sendQueue.Clear();
+	m_recvQueue.Clear();
 	m_fragment.clear();
 }
 
@@ -179,12 +184,14 @@ void LwsTransport::Send(const uint8_t* p_data, size_t p_length)
 		return;
 	}
 
-	std::vector<uint8_t> buf(LWS_PRE + p_length);
-	SDL_memcpy(&buf[LWS_PRE], p_data, p_length);
+	std::vector<uint8_t>* slot = m_sendQueue.BeginWrite();
+	if (!slot) {
+		SDL_Log("[Multiplayer] Send queue full, dropping message (type %d)", ParseMessageType(p_data, p_length));
+		return;
+	}
 
-	m_sendCS.Enter();
-	m_sendQueue.push_back(std::move(buf));
-	m_sendCS.Leave();
+	slot->assign(p_data, p_data + p_length);
+	m_sendQueue.CommitWrite();
 
 	m_wantWritable.store(true);
 	if (m_context) {
@@ -198,28 +205,93 @@ size_t LwsTransport::Receive(std::function<void(const uint8_t*, size_t)> p_callb
 		return 0;
 	}
 
-	std::deque<std::vector<uint8_t>> local;
+	// Only drain what is queued now; frames arriving during the callbacks wait for the next call.
+	size_t count = m_recvQueue.Size();
+	for (size_t i = 0; i < count; i++) {
+		std::vector<uint8_t>* msg = m_recvQueue.Peek();
+		p_callback(msg->data(), msg->size());
+		m_recvQueue.Pop();
+	}
+
+	// Wake the service thread so it can resume reading into the freed slots.
+	if (count > 0 && m_rxPaused.load()) {
+		lws_cancel_service(m_context);
+	}
+
+	return count;
+}
+
+// Moves the completed message in m_fragment into the receive queue.
+// Returns false if the queue is full; the message stays in m_fragment.
+bool LwsTransport::PushReceived()
+{
+	std::vector<uint8_t>* slot = m_recvQueue.BeginWrite();
+	if (!slot) {
+		return false;
+	}
+
+	// Swap rather than copy: the slot's old buffer becomes the next fragment buffer.
+	slot->swap(m_fragment);
+	m_recvQueue.CommitWrite();
+	m_fragment.clear();
+	return true;
+}
+
+// Fills m_writeBuffer (after LWS_PRE) with the next outgoing frame and returns its length.
+// Consecutive small messages are packed into one MSG_BATCH frame, which the relay splits
+// back into individual messages.
+size_t LwsTransport::CoalesceOutgoing()
+{
+	std::vector<uint8_t>* front = m_sendQueue.Peek();
+	if (!front) {
+		return 0;
+	}
+
+	std::vector<uint8_t>* next = m_sendQueue.Peek(1);
+	size_t pairSize = 1 + 2 * BATCH_LENGTH_PREFIX_SIZE + front->size() + (next ? next->size() : 0);
+
+	if (!next || pairSize > MAX_BATCH_FRAME_SIZE) {
+		size_t length = front->size();
+		m_writeBuffer.resize(LWS_PRE + length);
+		SDL_memcpy(&m_writeBuffer[LWS_PRE], front->data(), length);
+		m_sendQueue.Pop();
+		return length;
+	}
+
+	m_writeBuffer.resize(LWS_PRE + 1);
+	m_writeBuffer[LWS_PRE] = MSG_BATCH;
 
-	m_recvCS.Enter();
-	local.swap(m_recvQueue);
-	m_recvCS.Leave();
+	while ((front = m_sendQueue.Peek()) != nullptr) {
+		size_t offset = m_writeBuffer.size();
+		if (offset - LWS_PRE + BATCH_LENGTH_PREFIX_SIZE + front->size() > MAX_BATCH_FRAME_SIZE) {
+			break;
+		}
 
-	for (const auto& msg : local) {
-		p_callback(msg.data(), msg.size());
+		uint16_t length = (uint16_t) front->size();
+		m_writeBuffer.resize(offset + BATCH_LENGTH_PREFIX_SIZE + length);
+		SDL_memcpy(&m_writeBuffer[offset], &length, BATCH_LENGTH_PREFIX_SIZE);
+		SDL_memcpy(&m_writeBuffer[offset + BATCH_LENGTH_PREFIX_SIZE], front->data(), length);
+		m_sendQueue.Pop();
 	}
 
-	return local.size();
+	return m_writeBuffer.size() - LWS_PRE;
 }
 
 void LwsTransport::ServiceLoop()
 {
-	if (m_wantWritable.exchange(false)) {
-		struct lws* wsi = m_wsi.load();
+	struct lws* wsi = m_wsi.load();
+
+	if (m_rxPaused.load() && PushReceived()) {
+		m_rxPaused.store(false);
 		if (wsi) {
-			lws_callback_on_writable(wsi);
+			lws_rx_flow_control(wsi, 1);
 		}
 	}
 
+	if (m_wantWritable.exchange(false) && wsi) {
+		lws_callback_on_writable(wsi);
+	}
+
 	lws_service(m_context, LWS_SERVICE_TIMEOUT_MS);
 }
 
@@ -234,32 +306,22 @@ int LwsTransport::HandleLwsEvent(struct lws* p_wsi, int p_reason, void* p_in, si
 
 	case LWS_CALLBACK_CLIENT_RECEIVE:
 		m_fragment.insert(m_fragment.end(), static_cast<uint8_t*>(p_in), static_cast<uint8_t*>(p_in) + p_len);
-		if (lws_is_final_fragment(p_wsi)) {
-			m_recvCS.Enter();
-			m_recvQueue.push_back(std::move(m_fragment));
-			m_recvCS.Leave();
-			m_fragment.clear();
+		if (lws_is_final_fragment(p_wsi) && !PushReceived()) {
+			// Game thread is behind; stop reading until it drains the queue (see ServiceLoop).
+			m_rxPaused.store(true);
+			lws_rx_flow_control(p_wsi, 0);
 		}
 		break;
 
 	case LWS_CALLBACK_CLIENT_WRITEABLE: {
-		m_sendCS.Enter();
-		if (!m_sendQueue.empty()) {
-			std::vector<uint8_t> front = std::move(m_sendQueue.front());
-			m_sendQueue.pop_front();
-			bool hasMore = !m_sendQueue.empty();
-			m_sendCS.Leave();
+		size_t length = CoalesceOutgoing();
+		if (length > 0) {
+			lws_write(p_wsi, &m_writeBuffer[LWS_PRE], length, LWS_WRITE_BINARY);
 
-			size_t payloadLen = front.size() - LWS_PRE;
-			lws_write(p_wsi, &front[LWS_PRE], payloadLen, LWS_WRITE_BINARY);
-
-			if (hasMore) {
+			if (!m_sendQueue.IsEmpty()) {
 				lws_callback_on_writable(p_wsi);
 			}
 		}
-		else {
-			m_sendCS.Leave();
-		}
 		break;
 	}
 
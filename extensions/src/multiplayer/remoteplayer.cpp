@@ -35,6 +35,7 @@ RemotePlayer::RemotePlayer(uint32_t p_peerId, uint8_t p_actorId, uint8_t p_displ
 	: m_peerId(p_peerId), m_actorId(p_actorId), m_displayActorIndex(p_displayActorIndex), m_roi(nullptr),
 	  m_spawned(false), m_visible(false), m_targetSpeed(0.0f), m_targetVehicleType(VEHICLE_NONE),
 	  m_targetWorldId(Multiplayer::WORLD_NOT_VISIBLE), m_lastUpdateTime(SDL_GetTicks()), m_hasReceivedUpdate(false),
+	  m_deferredState{}, m_hasDeferredState(false),
 	  m_animator(Common::CharacterAnimatorConfig{
 		  /*.saveExtraAnimTransform=*/false,
 		  /*.propSuffix=*/p_peerId,
@@ -159,6 +160,22 @@ void RemotePlayer::UpdateFromNetwork(const PlayerStateMsg& p_msg)
 		m_hasReceivedUpdate = true;
 	}
 
+	m_allowRemoteCustomize = (p_msg.customizeFlags & CUSTOMIZE_FLAG_ALLOW_REMOTE) != 0;
+
+	// Hidden remotes (other world or restricted area) keep only the latest appearance;
+	// rebuilding bubbles and animation caches is deferred until they become visible again.
+	if (m_spawned && !m_visible) {
+		m_deferredState = p_msg;
+		m_hasDeferredState = true;
+		return;
+	}
+
+	m_hasDeferredState = false;
+	ApplyAppearance(p_msg);
+}
+
+void RemotePlayer::ApplyAppearance(const PlayerStateMsg& p_msg)
+{
 	// Update display name (can change when player switches save file)
 	char newName[USERNAME_BUFFER_SIZE];
 	SDL_memcpy(newName, p_msg.name, sizeof(newName));
@@ -185,9 +202,6 @@ void RemotePlayer::UpdateFromNetwork(const PlayerStateMsg& p_msg)
 		}
 	}
 
-	// Update allow remote customize flag
-	m_allowRemoteCustomize = (p_msg.customizeFlags & CUSTOMIZE_FLAG_ALLOW_REMOTE) != 0;
-
 	// Sync multi-part emote frozen state from remote
 	bool isFrozen = (p_msg.customizeFlags & CUSTOMIZE_FLAG_FROZEN) != 0;
 	int8_t frozenEmoteId =
@@ -256,6 +270,11 @@ void RemotePlayer::SetVisible(bool p_visible)
 
 	m_visible = p_visible;
 
+	if (p_visible && m_hasDeferredState) {
+		m_hasDeferredState = false;
+		ApplyAppearance(m_deferredState);
+	}
+
 	if (p_visible) {
 		if (m_animator.GetCurrentVehicleType() != VEHICLE_NONE && IsLargeVehicle(m_animator.GetCurrentVehicleType())) {
 			m_roi->SetVisibility(FALSE);
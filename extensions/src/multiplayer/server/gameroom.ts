@@ -1,19 +1,32 @@
 import {
 	HEADER_SIZE,
+	MSG_BATCH,
+	MSG_STATE,
 	TARGET_BROADCAST,
 	TARGET_HOST,
 	TARGET_BROADCAST_ALL,
 	createAssignIdMsg,
 	createHostAssignMsg,
 	createLeaveMsg,
+	isInInterest,
+	readInterestState,
 	readTarget,
+	splitBatch,
 	stampSender,
 } from "./protocol";
 import type { Env } from "./relay";
+import type { PeerInterestState } from "./protocol";
 import { CORS_HEADERS } from "./cors";
 
+// Out-of-interest MSG_STATE updates are still forwarded at this rate so that
+// receivers keep the player alive (client timeout is 5s) and notice world changes.
+const STATE_KEEPALIVE_MS = 1000;
+
 export class GameRoom implements DurableObject {
 	private connections = new Map<number, WebSocket>();
+	private interestStates = new Map<number, PeerInterestState>();
+	// Last forward time of a culled MSG_STATE, keyed by `${sender}:${receiver}`
+	private lastStateForward = new Map<string, number>();
 	private nextPeerId = 1;
 	private hostPeerId = 0;
 	private maxPlayers = 5;
@@ -158,6 +171,13 @@ export class GameRoom implements DurableObject {
 
 	private handleDisconnect(peerId: number): void {
 		this.connections.delete(peerId);
+		this.interestStates.delete(peerId);
+		for (const key of this.lastStateForward.keys()) {
+			const [sender, receiver] = key.split(":").map(Number);
+			if (sender === peerId || receiver === peerId) {
+				this.lastStateForward.delete(key);
+			}
+		}
 		this.broadcast(createLeaveMsg(peerId));
 		this.notifyRegistry().catch(() => {});
 
@@ -172,6 +192,17 @@ export class GameRoom implements DurableObject {
 		}
 
 		const data = new Uint8Array(event.data);
+		if (data.length > 0 && data[0] === MSG_BATCH) {
+			for (const msg of splitBatch(data)) {
+				this.routeMessage(msg, peerId);
+			}
+			return;
+		}
+
+		this.routeMessage(data, peerId);
+	}
+
+	private routeMessage(data: Uint8Array, peerId: number): void {
 		if (data.length < HEADER_SIZE) {
 			return;
 		}
@@ -179,7 +210,9 @@ export class GameRoom implements DurableObject {
 		const stamped = stampSender(data, peerId);
 		const target = readTarget(stamped);
 
-		if (target === TARGET_BROADCAST) {
+		if (target === TARGET_BROADCAST && stamped[0] === MSG_STATE) {
+			this.broadcastState(stamped, peerId);
+		} else if (target === TARGET_BROADCAST) {
 			this.broadcastExcept(stamped.buffer, peerId);
 		} else if (target === TARGET_HOST) {
 			this.sendToHost(stamped);
@@ -222,6 +255,55 @@ export class GameRoom implements DurableObject {
 		}
 	}
 
+	/**
+	 * Area-of-interest filtered broadcast for MSG_STATE. Receivers outside the
+	 * sender's interest get a keep-alive at most every STATE_KEEPALIVE_MS. The
+	 * host always receives every update since it coordinates animations by position.
+	 */
+	private broadcastState(data: Uint8Array, senderId: number): void {
+		const senderState = readInterestState(data);
+		const previousState = this.interestStates.get(senderId);
+		if (senderState) {
+			this.interestStates.set(senderId, senderState);
+		}
+
+		// Malformed updates and world changes (which toggle visibility on receivers) bypass culling.
+		if (
+			!senderState ||
+			!previousState ||
+			previousState.worldId !== senderState.worldId
+		) {
+			this.broadcastExcept(data.buffer, senderId);
+			return;
+		}
+
+		const now = Date.now();
+		for (const [id, ws] of this.connections) {
+			if (id === senderId) {
+				continue;
+			}
+
+			const receiverState = this.interestStates.get(id);
+			const interested =
+				id === this.hostPeerId ||
+				!receiverState ||
+				isInInterest(senderState, receiverState);
+
+			if (!interested) {
+				const key = `${senderId}:${id}`;
+				const last = this.lastStateForward.get(key) ?? 0;
+				if (now - last < STATE_KEEPALIVE_MS) {
+					continue;
+				}
+				this.lastStateForward.set(key, now);
+			}
+
+			if (!this.trySend(ws, data.buffer)) {
+				this.connections.delete(id);
+			}
+		}
+	}
+
 	private trySend(ws: WebSocket, data: ArrayBuffer): boolean {
 		try {
 			ws.send(data);
@@ -13,9 +13,25 @@ export const TARGET_BROADCAST_ALL = 0xfffffffe;
 
 // Message types used by server message constructors only.
 export const MSG_LEAVE = 2;
+export const MSG_STATE = 3;
 export const MSG_HOST_ASSIGN = 4;
+export const MSG_BATCH = 17;
 export const MSG_ASSIGN_ID = 0xff;
 
+// PlayerStateMsg field offsets: header(14) + actorId(1) + worldId(1) + vehicleType(1) + position(3 * 4)
+const STATE_WORLD_ID_OFFSET = HEADER_SIZE + 1;
+const STATE_POSITION_X_OFFSET = HEADER_SIZE + 3;
+const STATE_POSITION_Z_OFFSET = HEADER_SIZE + 3 + 8;
+const STATE_MIN_SIZE = STATE_POSITION_Z_OFFSET + 4;
+
+// Area-of-interest constants — must stay in sync with interestgrid.h
+const WORLD_ISLE = 0; // LegoOmni::e_act1
+const INTEREST_CELL_SIZE = 40.0;
+const INTEREST_FAR_CELLS = 4;
+
+// MSG_BATCH: type(1) followed by [length(2) + message] records
+const BATCH_LENGTH_PREFIX_SIZE = 2;
+
 // AssignIdMsg: compact server-only message — type(1) + peerId(4)
 const ASSIGN_ID_SIZE = 1 + 4;
 
@@ -62,3 +78,55 @@ export function stampSender(data: Uint8Array, peerId: number): Uint8Array {
 export function readTarget(data: Uint8Array): number {
 	return new DataView(data.buffer).getUint32(TARGET_OFFSET, true);
 }
+
+/** Split a MSG_BATCH frame into its messages. Stops at the first truncated record. */
+export function splitBatch(data: Uint8Array): Uint8Array[] {
+	const messages: Uint8Array[] = [];
+	const view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+	let offset = 1;
+	while (offset + BATCH_LENGTH_PREFIX_SIZE <= data.length) {
+		const length = view.getUint16(offset, true);
+		offset += BATCH_LENGTH_PREFIX_SIZE;
+		if (offset + length > data.length) {
+			break;
+		}
+		messages.push(data.subarray(offset, offset + length));
+		offset += length;
+	}
+	return messages;
+}
+
+export interface PeerInterestState {
+	worldId: number;
+	cellX: number;
+	cellZ: number;
+}
+
+/** Extract the sender's world and grid cell from a MSG_STATE message. */
+export function readInterestState(data: Uint8Array): PeerInterestState | null {
+	if (data.length < STATE_MIN_SIZE || data[0] !== MSG_STATE) {
+		return null;
+	}
+	const view = new DataView(data.buffer, data.byteOffset, data.byteLength);
+	return {
+		worldId: view.getInt8(STATE_WORLD_ID_OFFSET),
+		cellX: Math.floor(
+			view.getFloat32(STATE_POSITION_X_OFFSET, true) / INTEREST_CELL_SIZE
+		),
+		cellZ: Math.floor(
+			view.getFloat32(STATE_POSITION_Z_OFFSET, true) / INTEREST_CELL_SIZE
+		),
+	};
+}
+
+/** Mirrors ComputeInterest() in interestgrid.cpp: true for INTEREST_NEAR or INTEREST_FAR. */
+export function isInInterest(a: PeerInterestState, b: PeerInterestState): boolean {
+	if (a.worldId !== WORLD_ISLE || b.worldId !== WORLD_ISLE) {
+		return false;
+	}
+	const distance = Math.max(
+		Math.abs(a.cellX - b.cellX),
+		Math.abs(a.cellZ - b.cellZ)
+	);
+	return distance <= INTEREST_FAR_CELLS;
+}
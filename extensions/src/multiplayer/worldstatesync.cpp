@@ -16,7 +16,6 @@
 #include "mxvariabletable.h"
 
 #include <SDL3/SDL_stdinc.h>
-#include <vector>
 
 extern MxU8 g_counters[];
 extern MxU8 g_buildingInfoDownshift[];
@@ -242,9 +241,11 @@ void WorldStateSync::SendWorldSnapshot(uint32_t p_targetPeerId)
 		return;
 	}
 
-	// Serialize plant + building + sky/light state (~1149 bytes max, use 4096 for safety).
-	uint8_t stateBuffer[4096];
-	LegoMemory memory(stateBuffer, sizeof(stateBuffer));
+	// Serialize plant + building + sky/light state (~1149 bytes max, use 4096 for safety)
+	// directly behind the message header, so the whole message is built in one stack buffer.
+	uint8_t msgBuffer[sizeof(WorldSnapshotMsg) + 4096];
+	uint8_t* stateBuffer = msgBuffer + sizeof(WorldSnapshotMsg);
+	LegoMemory memory(stateBuffer, sizeof(msgBuffer) - sizeof(WorldSnapshotMsg));
 
 	PlantManager()->Write(&memory);
 	BuildingManager()->Write(&memory);
@@ -270,11 +271,9 @@ void WorldStateSync::SendWorldSnapshot(uint32_t p_targetPeerId)
 	msg.header = {MSG_WORLD_SNAPSHOT, 0, m_localPeerId, m_sequence++, p_targetPeerId};
 	msg.dataLength = (uint16_t) dataLength;
 
-	std::vector<uint8_t> msgBuf(sizeof(WorldSnapshotMsg) + dataLength);
-	SDL_memcpy(msgBuf.data(), &msg, sizeof(WorldSnapshotMsg));
-	SDL_memcpy(msgBuf.data() + sizeof(WorldSnapshotMsg), stateBuffer, dataLength);
+	SDL_memcpy(msgBuffer, &msg, sizeof(WorldSnapshotMsg));
 
-	m_transport->Send(msgBuf.data(), msgBuf.size());
+	m_transport->Send(msgBuffer, sizeof(WorldSnapshotMsg) + dataLength);
 }
 
 void WorldStateSync::BroadcastWorldEvent(uint8_t p_entityType, uint8_t p_changeType, uint8_t p_entityIndex)
@@ -1,5 +1,6 @@
 #include "d3drmrenderer_opengles2.h"
 #include "meshutils.h"
+#include "surfaceutils.h"
 
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
@@ -261,17 +262,14 @@ GLES2MeshCacheEntry GLES2UploadMesh(const MeshGroup& meshGroup, bool forceUV = f
 
 bool OpenGLES2Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI)
 {
-	SDL_Surface* surf = source;
-	if (source->format != SDL_PIXELFORMAT_RGBA32) {
-		surf = SDL_ConvertSurface(source, SDL_PIXELFORMAT_RGBA32);
-		if (!surf) {
-			return false;
-		}
+	const void* pixels = GetRGBA32Pixels(source, m_pixelBuffer);
+	if (!pixels) {
+		return false;
 	}
 
 	glGenTextures(1, &outTexId);
 	glBindTexture(GL_TEXTURE_2D, outTexId);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, surf->w, surf->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, surf->pixels);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, source->w, source->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
 	if (isUI) {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -290,8 +288,21 @@ bool OpenGLES2Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, boo
 		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
-	if (surf != source) {
-		SDL_DestroySurface(surf);
+	return true;
+}
+
+bool OpenGLES2Renderer::UpdateTexture(SDL_Surface* source, GLuint texId, bool isUI)
+{
+	const void* pixels = GetRGBA32Pixels(source, m_pixelBuffer);
+	if (!pixels) {
+		return false;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texId);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, source->w, source->h, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+	if (!isUI) {
+		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
 	return true;
@@ -444,10 +455,20 @@ Uint32 OpenGLES2Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 		auto& tex = m_textures[i];
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
-				glDeleteTextures(1, &tex.glTextureId);
-				if (UploadTexture(surface->m_surface, tex.glTextureId, isUI)) {
+				SDL_Surface* surf = surface->m_surface;
+
+				// Same-sized updates (videos, animated textures) are written into the existing texture
+				if (tex.width == surf->w && tex.height == surf->h && UpdateTexture(surf, tex.glTextureId, isUI)) {
 					tex.version = texture->m_version;
 				}
+				else {
+					glDeleteTextures(1, &tex.glTextureId);
+					if (UploadTexture(surf, tex.glTextureId, isUI)) {
+						tex.version = texture->m_version;
+						tex.width = surf->w;
+						tex.height = surf->h;
+					}
+				}
 			}
 			return i;
 		}
@@ -1,5 +1,6 @@
 #include "d3drmrenderer_opengles3.h"
 #include "meshutils.h"
+#include "surfaceutils.h"
 
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
@@ -12,6 +13,8 @@
 #define glBindVertexArray glBindVertexArrayAPPLE
 #define glGenVertexArrays glGenVertexArraysAPPLE
 #define glDeleteVertexArrays glDeleteVertexArraysAPPLE
+#define glDrawElementsInstanced glDrawElementsInstancedARB
+#define glVertexAttribDivisor glVertexAttribDivisorARB
 #endif
 #else
 #include <GLES2/gl2ext.h>
@@ -19,8 +22,13 @@
 #endif
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <cstddef>
 #include <string>
 
+// Per-instance attributes of instanced draws; a mat4 takes four consecutive locations and a mat3 three
+static constexpr GLuint INSTANCE_MODEL_VIEW_LOC = 3;
+static constexpr GLuint INSTANCE_NORMAL_LOC = 7;
+
 static GLuint CompileShader(GLenum type, const char* source)
 {
 	GLuint shader = glCreateShader(type);
@@ -90,20 +98,25 @@ Direct3DRMRenderer* OpenGLES3Renderer::Create(DWORD width, DWORD height, DWORD m
 		in vec3 a_position;
 		in vec3 a_normal;
 		in vec2 a_texCoord;
+		in mat4 a_instanceModelView;
+		in mat3 a_instanceNormal;
 
 		uniform mat4 u_modelViewMatrix;
 		uniform mat3 u_normalMatrix;
 		uniform mat4 u_projectionMatrix;
+		uniform bool u_instanced;
 
 		out vec3 v_viewPos;
 		out vec3 v_normal;
 		out vec2 v_texCoord;
 
 		void main() {
-			vec4 viewPos = u_modelViewMatrix * vec4(a_position, 1.0);
+			mat4 modelViewMatrix = u_instanced ? a_instanceModelView : u_modelViewMatrix;
+			mat3 normalMatrix = u_instanced ? a_instanceNormal : u_normalMatrix;
+			vec4 viewPos = modelViewMatrix * vec4(a_position, 1.0);
 			gl_Position = u_projectionMatrix * viewPos;
 			v_viewPos = viewPos.xyz;
-			v_normal = normalize(u_normalMatrix * a_normal);
+			v_normal = normalize(normalMatrix * a_normal);
 			v_texCoord = a_texCoord;
 		}
 	)";
@@ -189,6 +202,8 @@ Direct3DRMRenderer* OpenGLES3Renderer::Create(DWORD width, DWORD height, DWORD m
 	glBindAttribLocation(shaderProgram, 0, "a_position");
 	glBindAttribLocation(shaderProgram, 1, "a_normal");
 	glBindAttribLocation(shaderProgram, 2, "a_texCoord");
+	glBindAttribLocation(shaderProgram, INSTANCE_MODEL_VIEW_LOC, "a_instanceModelView");
+	glBindAttribLocation(shaderProgram, INSTANCE_NORMAL_LOC, "a_instanceNormal");
 	glLinkProgram(shaderProgram);
 	glDeleteShader(vs);
 	glDeleteShader(fs);
@@ -275,17 +290,14 @@ GLES3MeshCacheEntry OpenGLES3Renderer::GLES3UploadMesh(const MeshGroup& meshGrou
 
 bool OpenGLES3Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI)
 {
-	SDL_Surface* surf = source;
-	if (source->format != SDL_PIXELFORMAT_RGBA32) {
-		surf = SDL_ConvertSurface(source, SDL_PIXELFORMAT_RGBA32);
-		if (!surf) {
-			return false;
-		}
+	const void* pixels = GetRGBA32Pixels(source, m_pixelBuffer);
+	if (!pixels) {
+		return false;
 	}
 
 	glGenTextures(1, &outTexId);
 	glBindTexture(GL_TEXTURE_2D, outTexId);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, surf->w, surf->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, surf->pixels);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, source->w, source->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
 	if (isUI) {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -304,8 +316,21 @@ bool OpenGLES3Renderer::UploadTexture(SDL_Surface* source, GLuint& outTexId, boo
 		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
-	if (surf != source) {
-		SDL_DestroySurface(surf);
+	return true;
+}
+
+bool OpenGLES3Renderer::UpdateTexture(SDL_Surface* source, GLuint texId, bool isUI)
+{
+	const void* pixels = GetRGBA32Pixels(source, m_pixelBuffer);
+	if (!pixels) {
+		return false;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texId);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, source->w, source->h, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+	if (!isUI) {
+		glGenerateMipmap(GL_TEXTURE_2D);
 	}
 
 	return true;
@@ -400,6 +425,18 @@ OpenGLES3Renderer::OpenGLES3Renderer(
 	m_modelViewMatrixLoc = glGetUniformLocation(m_shaderProgram, "u_modelViewMatrix");
 	m_normalMatrixLoc = glGetUniformLocation(m_shaderProgram, "u_normalMatrix");
 	m_projectionMatrixLoc = glGetUniformLocation(m_shaderProgram, "u_projectionMatrix");
+	m_instancedLoc = glGetUniformLocation(m_shaderProgram, "u_instanced");
+
+	glGenBuffers(1, &m_instanceVbo);
+#if defined(__APPLE__) && !TARGET_OS_IOS
+	// The legacy desktop context only has instancing through the ARB extensions
+	m_useInstancing = SDL_GL_ExtensionSupported("GL_ARB_instanced_arrays") &&
+					  SDL_GL_ExtensionSupported("GL_ARB_draw_instanced") &&
+					  SDL_GL_GetProcAddress("glDrawElementsInstancedARB") &&
+					  SDL_GL_GetProcAddress("glVertexAttribDivisorARB");
+#else
+	m_useInstancing = true;
+#endif
 
 	m_uiMesh.vertices = {
 		{{0.0f, 0.0f, 0.0f}, {0, 0, -1}, {0.0f, 0.0f}},
@@ -417,6 +454,7 @@ OpenGLES3Renderer::~OpenGLES3Renderer()
 {
 	SDL_DestroySurface(m_renderedImage);
 	glDeleteTextures(1, &m_dummyTexture);
+	glDeleteBuffers(1, &m_instanceVbo);
 	glDeleteProgram(m_shaderProgram);
 	glDeleteRenderbuffers(1, &m_colorTarget);
 	glDeleteRenderbuffers(1, &m_depthTarget);
@@ -481,10 +519,20 @@ Uint32 OpenGLES3Renderer::GetTextureId(IDirect3DRMTexture* iTexture, bool isUI,
 		auto& tex = m_textures[i];
 		if (tex.texture == texture) {
 			if (tex.version != texture->m_version) {
-				glDeleteTextures(1, &tex.glTextureId);
-				if (UploadTexture(surface->m_surface, tex.glTextureId, isUI)) {
+				SDL_Surface* surf = surface->m_surface;
+
+				// Same-sized updates (videos, animated textures) are written into the existing texture
+				if (tex.width == surf->w && tex.height == surf->h && UpdateTexture(surf, tex.glTextureId, isUI)) {
 					tex.version = texture->m_version;
 				}
+				else {
+					glDeleteTextures(1, &tex.glTextureId);
+					if (UploadTexture(surf, tex.glTextureId, isUI)) {
+						tex.version = texture->m_version;
+						tex.width = surf->w;
+						tex.height = surf->h;
+					}
+				}
 			}
 			return i;
 		}
@@ -629,6 +677,71 @@ void OpenGLES3Renderer::SubmitDraw(
 
 	glUniformMatrix4fv(m_modelViewMatrixLoc, 1, GL_FALSE, &modelViewMatrix[0][0]);
 	glUniformMatrix3fv(m_normalMatrixLoc, 1, GL_FALSE, &normalMatrix[0][0]);
+	SetAppearance(appearance);
+
+	glBindVertexArray(mesh.vao);
+	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indices.size()), GL_UNSIGNED_SHORT, nullptr);
+	glBindVertexArray(0);
+}
+
+void OpenGLES3Renderer::SubmitDrawInstanced(
+	DWORD meshId,
+	const DrawInstance* instances,
+	size_t count,
+	const D3DRMMATRIX4D& viewMatrix,
+	const Appearance& appearance
+)
+{
+	if (!m_useInstancing) {
+		Direct3DRMRenderer::SubmitDrawInstanced(meshId, instances, count, viewMatrix, appearance);
+		return;
+	}
+
+	auto& mesh = m_meshs[meshId];
+
+	SetAppearance(appearance);
+	glUniform1i(m_instancedLoc, 1);
+
+	glBindVertexArray(mesh.vao);
+	glBindBuffer(GL_ARRAY_BUFFER, m_instanceVbo);
+	glBufferData(GL_ARRAY_BUFFER, count * sizeof(DrawInstance), instances, GL_STREAM_DRAW);
+
+	const GLsizei stride = sizeof(DrawInstance);
+	for (GLuint i = 0; i < 4; ++i) {
+		size_t offset = offsetof(DrawInstance, modelViewMatrix) + i * sizeof(D3DRMMATRIX4D) / 4;
+		glEnableVertexAttribArray(INSTANCE_MODEL_VIEW_LOC + i);
+		glVertexAttribPointer(INSTANCE_MODEL_VIEW_LOC + i, 4, GL_FLOAT, GL_FALSE, stride, (const void*) offset);
+		glVertexAttribDivisor(INSTANCE_MODEL_VIEW_LOC + i, 1);
+	}
+	for (GLuint i = 0; i < 3; ++i) {
+		size_t offset = offsetof(DrawInstance, normalMatrix) + i * sizeof(Matrix3x3) / 3;
+		glEnableVertexAttribArray(INSTANCE_NORMAL_LOC + i);
+		glVertexAttribPointer(INSTANCE_NORMAL_LOC + i, 3, GL_FLOAT, GL_FALSE, stride, (const void*) offset);
+		glVertexAttribDivisor(INSTANCE_NORMAL_LOC + i, 1);
+	}
+
+	glDrawElementsInstanced(
+		GL_TRIANGLES,
+		static_cast<GLsizei>(mesh.indices.size()),
+		GL_UNSIGNED_SHORT,
+		nullptr,
+		static_cast<GLsizei>(count)
+	);
+
+	// The instance arrays are VAO state; the mesh's VAO must not keep them for regular draws
+	for (GLuint i = 0; i < 4; ++i) {
+		glDisableVertexAttribArray(INSTANCE_MODEL_VIEW_LOC + i);
+	}
+	for (GLuint i = 0; i < 3; ++i) {
+		glDisableVertexAttribArray(INSTANCE_NORMAL_LOC + i);
+	}
+	glBindVertexArray(0);
+
+	glUniform1i(m_instancedLoc, 0);
+}
+
+void OpenGLES3Renderer::SetAppearance(const Appearance& appearance)
+{
 	glUniformMatrix4fv(m_projectionMatrixLoc, 1, GL_FALSE, &m_projection[0][0]);
 
 	glUniform4f(
@@ -653,10 +766,6 @@ void OpenGLES3Renderer::SubmitDraw(
 		glBindTexture(GL_TEXTURE_2D, m_dummyTexture);
 		glUniform1i(m_textureLoc, 0);
 	}
-
-	glBindVertexArray(mesh.vao);
-	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indices.size()), GL_UNSIGNED_SHORT, nullptr);
-	glBindVertexArray(0);
 }
 
 HRESULT OpenGLES3Renderer::FinalizeFrame()
@@ -454,14 +454,14 @@ void Direct3DRMPaletteSWRenderer::DrawTriangleClipped(const PalLitVertex (&v)[3]
 	}
 }
 
-// Nearest palette entry for a material colour, memoized — consecutive
-// triangles (and usually consecutive draws) reuse the same colour, so the
-// 256-entry search runs once per colour change instead of once per triangle.
+// Nearest palette entry for a material colour, memoized — draws cycle
+// through a small set of material colours, so the 256-entry search runs
+// once per colour per palette instead of once per colour change.
 Uint8 Direct3DRMPaletteSWRenderer::GetMaterialPaletteIndex(const SDL_Color& color)
 {
-	if (m_materialCacheValid && m_cachedMaterialColor.r == color.r && m_cachedMaterialColor.g == color.g &&
-		m_cachedMaterialColor.b == color.b) {
-		return m_cachedMaterialIdx;
+	MaterialCacheEntry& entry = m_materialCache[(color.r * 7 + color.g * 3 + color.b) & (MATERIAL_CACHE_SIZE - 1)];
+	if (entry.valid && entry.color.r == color.r && entry.color.g == color.g && entry.color.b == color.b) {
+		return entry.index;
 	}
 
 	Uint8 bestIdx = 0;
@@ -482,9 +482,9 @@ Uint8 Direct3DRMPaletteSWRenderer::GetMaterialPaletteIndex(const SDL_Color& colo
 		}
 	}
 
-	m_cachedMaterialColor = color;
-	m_cachedMaterialIdx = bestIdx;
-	m_materialCacheValid = true;
+	entry.color = color;
+	entry.index = bestIdx;
+	entry.valid = true;
 	return bestIdx;
 }
 
@@ -1201,7 +1201,7 @@ HRESULT Direct3DRMPaletteSWRenderer::BeginFrame()
 		BuildLightingLUT();
 		// Blend rows are rebuilt lazily on first transparent use.
 		memset(m_blendRowValid, 0, sizeof(m_blendRowValid));
-		m_materialCacheValid = false;
+		InvalidateMaterialCache();
 	}
 
 	ClearZBuffer();
@@ -1546,7 +1546,7 @@ void Direct3DRMPaletteSWRenderer::SetPalette(SDL_Palette* palette)
 {
 	m_palette = palette;
 	m_lightLUTDirty = true;
-	m_materialCacheValid = false;
+	InvalidateMaterialCache();
 	if (m_renderedImage) {
 		SDL_SetSurfacePalette(m_renderedImage, palette);
 	}
@@ -5,23 +5,13 @@
 #include "mathutils.h"
 #include "meshutils.h"
 #include "miniwin.h"
+#include "surfaceutils.h"
 
 #include <SDL3/SDL.h>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 
-struct ScopedSurface {
-	SDL_Surface* ptr = nullptr;
-	~ScopedSurface()
-	{
-		if (ptr) {
-			SDL_DestroySurface(ptr);
-		}
-	}
-	void release() { ptr = nullptr; }
-};
-
 struct ScopedTexture {
 	SDL_GPUDevice* dev;
 	SDL_GPUTexture* ptr = nullptr;
@@ -440,20 +430,15 @@ void Direct3DRMSDL3GPURenderer::AddTextureDestroyCallback(Uint32 id, IDirect3DRM
 
 SDL_GPUTexture* Direct3DRMSDL3GPURenderer::CreateTextureFromSurface(SDL_Surface* surface)
 {
-	ScopedSurface surf{SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32)};
-	if (!surf.ptr) {
-		SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_ConvertSurface (%s)", SDL_GetError());
-		return nullptr;
-	}
-
-	const Uint32 dataSize = surf.ptr->pitch * surf.ptr->h;
+	const Uint32 pitch = surface->w * 4;
+	const Uint32 dataSize = pitch * surface->h;
 
 	SDL_GPUTextureCreateInfo textureInfo = {};
 	textureInfo.type = SDL_GPU_TEXTURETYPE_2D;
 	textureInfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
 	textureInfo.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
-	textureInfo.width = surf.ptr->w;
-	textureInfo.height = surf.ptr->h;
+	textureInfo.width = surface->w;
+	textureInfo.height = surface->h;
 	textureInfo.layer_count_or_depth = 1;
 	textureInfo.num_levels = 1;
 	ScopedTexture texture{m_device, SDL_CreateGPUTexture(m_device, &textureInfo)};
@@ -468,15 +453,25 @@ SDL_GPUTexture* Direct3DRMSDL3GPURenderer::CreateTextureFromSurface(SDL_Surface*
 		SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_MapGPUTransferBuffer (%s)", SDL_GetError());
 		return nullptr;
 	}
-	memcpy(transferData, surf.ptr->pixels, dataSize);
+
+	// Indexed surfaces (most textures and all 2D frames) are expanded straight into the transfer buffer
+	if (!ExpandIndexedPixels(surface, SDL_PIXELFORMAT_RGBA32, transferData, pitch)) {
+		const void* pixels = GetRGBA32Pixels(surface, m_pixelBuffer);
+		if (!pixels) {
+			SDL_UnmapGPUTransferBuffer(m_device, transferBuffer);
+			SDL_LogError(LOG_CATEGORY_MINIWIN, "SDL_ConvertSurface (%s)", SDL_GetError());
+			return nullptr;
+		}
+		memcpy(transferData, pixels, dataSize);
+	}
 	SDL_UnmapGPUTransferBuffer(m_device, transferBuffer);
 
 	SDL_GPUTextureTransferInfo transferRegionInfo = {};
 	transferRegionInfo.transfer_buffer = transferBuffer;
 	SDL_GPUTextureRegion textureRegion = {};
 	textureRegion.texture = texture.ptr;
-	textureRegion.w = surf.ptr->w;
-	textureRegion.h = surf.ptr->h;
+	textureRegion.w = surface->w;
+	textureRegion.h = surface->h;
 	textureRegion.d = 1;
 
 	SDL_GPUCommandBuffer* cmdbuf = SDL_AcquireGPUCommandBuffer(m_device);
@@ -799,6 +794,40 @@ void Direct3DRMSDL3GPURenderer::SubmitDraw(
 	SDL_DrawGPUIndexedPrimitives(m_renderPass, mesh.indexCount, 1, 0, 0, 0);
 }
 
+// The precompiled shaders take their transforms from uniforms only, so the batch still issues one draw per
+// instance, but the texture, shading data and mesh buffers are bound once for all of them.
+void Direct3DRMSDL3GPURenderer::SubmitDrawInstanced(
+	DWORD meshId,
+	const DrawInstance* instances,
+	size_t count,
+	const D3DRMMATRIX4D& viewMatrix,
+	const Appearance& appearance
+)
+{
+	m_fragmentShadingData.color = appearance.color;
+	m_fragmentShadingData.shininess = appearance.shininess;
+	bool useTexture = appearance.textureId != NO_TEXTURE_ID;
+	m_fragmentShadingData.useTexture = useTexture;
+
+	auto& mesh = m_meshs[meshId];
+
+	SDL_GPUTexture* texture = useTexture ? m_textures[appearance.textureId].gpuTexture : m_dummyTexture;
+	SDL_GPUTextureSamplerBinding samplerBinding = {texture, m_sampler};
+	SDL_BindGPUFragmentSamplers(m_renderPass, 0, &samplerBinding, 1);
+	SDL_PushGPUFragmentUniformData(m_cmdbuf, 0, &m_fragmentShadingData, sizeof(m_fragmentShadingData));
+	SDL_GPUBufferBinding vertexBufferBinding = {mesh.vertexBuffer};
+	SDL_BindGPUVertexBuffers(m_renderPass, 0, &vertexBufferBinding, 1);
+	SDL_GPUBufferBinding indexBufferBinding = {mesh.indexBuffer};
+	SDL_BindGPUIndexBuffer(m_renderPass, &indexBufferBinding, SDL_GPU_INDEXELEMENTSIZE_16BIT);
+
+	for (size_t i = 0; i < count; ++i) {
+		memcpy(&m_uniforms.worldViewMatrix, instances[i].modelViewMatrix, sizeof(D3DRMMATRIX4D));
+		PackNormalMatrix(instances[i].normalMatrix, m_uniforms.normalMatrix);
+		SDL_PushGPUVertexUniformData(m_cmdbuf, 0, &m_uniforms, sizeof(m_uniforms));
+		SDL_DrawGPUIndexedPrimitives(m_renderPass, mesh.indexCount, 1, 0, 0, 0);
+	}
+}
+
 HRESULT Direct3DRMSDL3GPURenderer::FinalizeFrame()
 {
 	return DD_OK;
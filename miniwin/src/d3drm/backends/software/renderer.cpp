@@ -4,6 +4,7 @@
 #include "mathutils.h"
 #include "meshutils.h"
 #include "miniwin.h"
+#include "surfaceutils.h"
 
 #include <SDL3/SDL.h>
 #include <algorithm>
@@ -52,7 +53,10 @@ void Direct3DRMSoftwareRenderer::PushLights(const SceneLight* lights, size_t cou
 {
 	// Fold ambient lights into a single base color and pre-normalize the
 	// directional light vectors so per-vertex lighting does no sqrt for them.
+	m_previousLights.swap(m_preparedLights);
 	m_preparedLights.clear();
+	float previousAmbient[3] = {m_ambientR, m_ambientG, m_ambientB};
+
 	m_ambientR = 0.0f;
 	m_ambientG = 0.0f;
 	m_ambientB = 0.0f;
@@ -79,6 +83,21 @@ void Direct3DRMSoftwareRenderer::PushLights(const SceneLight* lights, size_t cou
 		}
 		m_preparedLights.push_back(prepared);
 	}
+
+	// Lights are pushed every frame; only a real change invalidates the
+	// meshes' cached vertex colors.
+	bool changed = m_previousLights.size() != m_preparedLights.size() || previousAmbient[0] != m_ambientR ||
+				   previousAmbient[1] != m_ambientG || previousAmbient[2] != m_ambientB;
+	for (size_t i = 0; !changed && i < m_preparedLights.size(); ++i) {
+		const PreparedLight& a = m_previousLights[i];
+		const PreparedLight& b = m_preparedLights[i];
+		changed = a.positional != b.positional || memcmp(&a.vec, &b.vec, sizeof(a.vec)) != 0 ||
+				  memcmp(&a.color, &b.color, sizeof(a.color)) != 0;
+	}
+
+	if (changed) {
+		m_lightVersion++;
+	}
 }
 
 void Direct3DRMSoftwareRenderer::SetFrustumPlanes(const Plane* frustumPlanes)
@@ -668,10 +687,16 @@ Uint32 Direct3DRMSoftwareRenderer::GetTextureId(IDirect3DRMTexture* iTexture, bo
 		auto& texRef = m_textures[i];
 		if (texRef.texture == texture) {
 			if (texRef.version != texture->m_version) {
-				// Update animated textures
-				SDL_DestroySurface(texRef.cached);
-				texRef.cached = SDL_ConvertSurface(surface->m_surface, m_renderedImage->format);
-				SDL_LockSurface(texRef.cached);
+				// Update animated textures, in place when the size has not changed
+				SDL_Surface* cached = texRef.cached;
+				SDL_Surface* src = surface->m_surface;
+
+				if (cached->w != src->w || cached->h != src->h ||
+					!ExpandIndexedPixels(src, cached->format, cached->pixels, cached->pitch)) {
+					SDL_DestroySurface(texRef.cached);
+					texRef.cached = SDL_ConvertSurface(src, m_renderedImage->format);
+					SDL_LockSurface(texRef.cached);
+				}
 				texRef.version = texture->m_version;
 			}
 			return i;
@@ -697,6 +722,27 @@ Uint32 Direct3DRMSoftwareRenderer::GetTextureId(IDirect3DRMTexture* iTexture, bo
 	return static_cast<Uint32>(m_textures.size() - 1);
 }
 
+// Renumbers vertices in the order the index buffer first uses them and drops
+// unreferenced ones, so each draw transforms only what it needs and walks the
+// vertex arrays mostly front to back.  Triangle order is left alone, which
+// keeps the rasterized output identical.
+static void ReorderVerticesByFirstUse(std::vector<D3DRMVERTEX>& vertices, std::vector<uint16_t>& indices)
+{
+	std::vector<int> remap(vertices.size(), -1);
+	std::vector<D3DRMVERTEX> ordered;
+	ordered.reserve(vertices.size());
+
+	for (uint16_t& index : indices) {
+		if (remap[index] < 0) {
+			remap[index] = static_cast<int>(ordered.size());
+			ordered.push_back(vertices[index]);
+		}
+		index = static_cast<uint16_t>(remap[index]);
+	}
+
+	vertices.swap(ordered);
+}
+
 MeshCache UploadMesh(const MeshGroup& meshGroup)
 {
 	MeshCache cache{&meshGroup, meshGroup.version};
@@ -719,6 +765,7 @@ MeshCache UploadMesh(const MeshGroup& meshGroup)
 		cache.indices.assign(meshGroup.indices.begin(), meshGroup.indices.end());
 	}
 
+	ReorderVerticesByFirstUse(cache.vertices, cache.indices);
 	return cache;
 }
 
@@ -730,9 +777,7 @@ void Direct3DRMSoftwareRenderer::AddMeshDestroyCallback(Uint32 id, IDirect3DRMMe
 			auto* ctx = static_cast<CacheDestroyContext*>(arg);
 			auto& cacheEntry = ctx->renderer->m_meshs[ctx->id];
 			if (cacheEntry.meshGroup) {
-				cacheEntry.meshGroup = nullptr;
-				cacheEntry.vertices.clear();
-				cacheEntry.indices.clear();
+				cacheEntry = MeshCache{};
 			}
 			delete ctx;
 		},
@@ -799,17 +844,41 @@ void Direct3DRMSoftwareRenderer::SubmitDraw(
 	auto& mesh = m_meshs[meshId];
 	const size_t vertexCount = mesh.vertices.size();
 
+	bool sameTransform =
+		mesh.transformValid && memcmp(mesh.modelViewMatrix, modelViewMatrix, sizeof(D3DRMMATRIX4D)) == 0;
+	bool sameLighting = sameTransform && memcmp(mesh.normalMatrix, normalMatrix, sizeof(Matrix3x3)) == 0 &&
+						mesh.lightVersion == m_lightVersion &&
+						memcmp(&mesh.materialColor, &appearance.color, sizeof(SDL_Color)) == 0 &&
+						mesh.shininess == appearance.shininess;
+
+	std::vector<D3DVECTOR>& transformedPositions = mesh.transformedPositions;
+	std::vector<SDL_Color>& vertexColors = mesh.vertexColors;
+	std::vector<Uint8>& vertexLit = mesh.vertexLit;
+
 	// Pre-transform all vertex positions
-	m_transformedPositions.resize(vertexCount);
-	for (size_t i = 0; i < vertexCount; ++i) {
-		m_transformedPositions[i] = TransformPoint(mesh.vertices[i].position, modelViewMatrix);
+	if (!sameTransform) {
+		transformedPositions.resize(vertexCount);
+		for (size_t i = 0; i < vertexCount; ++i) {
+			transformedPositions[i] = TransformPoint(mesh.vertices[i].position, modelViewMatrix);
+		}
+
+		memcpy(mesh.modelViewMatrix, modelViewMatrix, sizeof(D3DRMMATRIX4D));
+		mesh.transformValid = true;
 	}
 
 	// Lighting is computed lazily, once per unique vertex, and only for
 	// vertices of triangles that survive backface culling.  Shared vertices
-	// previously got re-lit for every triangle that used them.
-	m_vertexColors.resize(vertexCount);
-	m_vertexLit.assign(vertexCount, 0);
+	// previously got re-lit for every triangle that used them.  Colors lit by
+	// an earlier draw under the same conditions are kept.
+	if (!sameLighting) {
+		vertexColors.resize(vertexCount);
+		vertexLit.assign(vertexCount, 0);
+
+		memcpy(mesh.normalMatrix, normalMatrix, sizeof(Matrix3x3));
+		mesh.lightVersion = m_lightVersion;
+		mesh.materialColor = appearance.color;
+		mesh.shininess = appearance.shininess;
+	}
 
 	const bool flat = appearance.flat;
 
@@ -818,9 +887,9 @@ void Direct3DRMSoftwareRenderer::SubmitDraw(
 		const uint16_t i0 = mesh.indices[i];
 		const uint16_t i1 = mesh.indices[i + 1];
 		const uint16_t i2 = mesh.indices[i + 2];
-		const D3DVECTOR& p0 = m_transformedPositions[i0];
-		const D3DVECTOR& p1 = m_transformedPositions[i1];
-		const D3DVECTOR& p2 = m_transformedPositions[i2];
+		const D3DVECTOR& p0 = transformedPositions[i0];
+		const D3DVECTOR& p1 = transformedPositions[i1];
+		const D3DVECTOR& p2 = transformedPositions[i2];
 
 		// Cull before lighting and clipping; sub-triangles produced by the
 		// near-plane clip are coplanar with the original, so this test is
@@ -829,27 +898,27 @@ void Direct3DRMSoftwareRenderer::SubmitDraw(
 			continue;
 		}
 
-		if (!m_vertexLit[i0]) {
-			m_vertexLit[i0] = 1;
-			m_vertexColors[i0] = ApplyLighting(p0, mesh.vertices[i0].normal, appearance);
+		if (!vertexLit[i0]) {
+			vertexLit[i0] = 1;
+			vertexColors[i0] = ApplyLighting(p0, mesh.vertices[i0].normal, appearance);
 		}
-		SDL_Color c0 = m_vertexColors[i0];
+		SDL_Color c0 = vertexColors[i0];
 		SDL_Color c1, c2;
 		if (flat) {
 			c1 = c0;
 			c2 = c0;
 		}
 		else {
-			if (!m_vertexLit[i1]) {
-				m_vertexLit[i1] = 1;
-				m_vertexColors[i1] = ApplyLighting(p1, mesh.vertices[i1].normal, appearance);
+			if (!vertexLit[i1]) {
+				vertexLit[i1] = 1;
+				vertexColors[i1] = ApplyLighting(p1, mesh.vertices[i1].normal, appearance);
 			}
-			if (!m_vertexLit[i2]) {
-				m_vertexLit[i2] = 1;
-				m_vertexColors[i2] = ApplyLighting(p2, mesh.vertices[i2].normal, appearance);
+			if (!vertexLit[i2]) {
+				vertexLit[i2] = 1;
+				vertexColors[i2] = ApplyLighting(p2, mesh.vertices[i2].normal, appearance);
 			}
-			c1 = m_vertexColors[i1];
-			c2 = m_vertexColors[i2];
+			c1 = vertexColors[i1];
+			c2 = vertexColors[i2];
 		}
 
 		SWLitVertex tri[3] = {
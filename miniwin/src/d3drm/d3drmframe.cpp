@@ -1,3 +1,4 @@
+#include "bvh.h"
 #include "d3drm_impl.h"
 #include "d3drmframe_impl.h"
 #include "d3drmlight_impl.h"
@@ -19,6 +20,7 @@ Direct3DRMFrameImpl::Direct3DRMFrameImpl(Direct3DRMFrameImpl* parent)
 
 Direct3DRMFrameImpl::~Direct3DRMFrameImpl()
 {
+	g_sceneVersion++;
 	m_children->Release();
 	m_lights->Release();
 	m_visuals->Release();
@@ -52,6 +54,7 @@ HRESULT Direct3DRMFrameImpl::AddChild(IDirect3DRMFrame* child)
 		SDL_assert(result == DD_OK);
 	}
 	childImpl->m_parent = this;
+	g_sceneVersion++;
 	return m_children->AddElement(child);
 }
 
@@ -61,6 +64,7 @@ HRESULT Direct3DRMFrameImpl::DeleteChild(IDirect3DRMFrame* child)
 	HRESULT result = m_children->DeleteElement(childImpl);
 	if (result == DD_OK) {
 		childImpl->m_parent = nullptr;
+		g_sceneVersion++;
 	}
 	return result;
 }
@@ -89,6 +93,7 @@ HRESULT Direct3DRMFrameImpl::AddTransform(D3DRMCOMBINETYPE combine, D3DRMMATRIX4
 	switch (combine) {
 	case D3DRMCOMBINETYPE::REPLACE:
 		std::memcpy(m_transform, matrix, sizeof(m_transform));
+		m_transformVersion++;
 		return DD_OK;
 	default:
 		MINIWIN_NOT_IMPLEMENTED();
@@ -110,11 +115,13 @@ HRESULT Direct3DRMFrameImpl::GetPosition(IDirect3DRMFrame* reference, D3DVECTOR*
 
 HRESULT Direct3DRMFrameImpl::AddVisual(IDirect3DRMVisual* visual)
 {
+	g_sceneVersion++;
 	return m_visuals->AddElement(visual);
 }
 
 HRESULT Direct3DRMFrameImpl::DeleteVisual(IDirect3DRMVisual* visual)
 {
+	g_sceneVersion++;
 	return m_visuals->DeleteElement(visual);
 }
 
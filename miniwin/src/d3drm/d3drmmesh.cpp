@@ -1,4 +1,5 @@
 #include "d3drmmesh_impl.h"
+#include "mathutils.h"
 #include "miniwin.h"
 
 #include <limits>
@@ -262,6 +263,7 @@ HRESULT Direct3DRMMeshImpl::SetVertices(D3DRMGROUPINDEX groupIndex, int offset,
 	UpdateBox();
 
 	group.version++;
+	g_sceneVersion++;
 
 	return DD_OK;
 }
@@ -306,3 +308,100 @@ HRESULT Direct3DRMMeshImpl::GetBox(D3DRMBOX* box)
 
 	return DD_OK;
 }
+
+static bool RayIntersectsTriangle(
+	const Ray& ray,
+	const D3DVECTOR& v0,
+	const D3DVECTOR& v1,
+	const D3DVECTOR& v2,
+	float& outDist
+)
+{
+	const float EPSILON = 1e-6f;
+	D3DVECTOR edge1 = {v1.x - v0.x, v1.y - v0.y, v1.z - v0.z};
+	D3DVECTOR edge2 = {v2.x - v0.x, v2.y - v0.y, v2.z - v0.z};
+
+	D3DVECTOR h = CrossProduct(ray.direction, edge2);
+	float a = DotProduct(edge1, h);
+	if (fabs(a) < EPSILON) {
+		return false;
+	}
+
+	float f = 1.0f / a;
+	D3DVECTOR s = {ray.origin.x - v0.x, ray.origin.y - v0.y, ray.origin.z - v0.z};
+	float u = f * DotProduct(s, h);
+	if (u < 0.0f || u > 1.0f) {
+		return false;
+	}
+
+	D3DVECTOR q = CrossProduct(s, edge1);
+	float v = f * DotProduct(ray.direction, q);
+	if (v < 0.0f || u + v > 1.0f) {
+		return false;
+	}
+
+	float t = f * DotProduct(edge2, q);
+	if (t > EPSILON) {
+		outDist = t;
+		return true;
+	}
+	return false;
+}
+
+void Direct3DRMMeshImpl::UpdatePickBVH()
+{
+	bool dirty = m_pickVersions.size() != m_groups.size();
+	for (size_t i = 0; i < m_groups.size() && !dirty; ++i) {
+		dirty = m_pickVersions[i] != m_groups[i].version;
+	}
+	if (!dirty) {
+		return;
+	}
+
+	m_pickVersions.resize(m_groups.size());
+	m_pickTriangles.clear();
+	std::vector<D3DRMBOX> bounds;
+
+	for (size_t gi = 0; gi < m_groups.size(); ++gi) {
+		const MeshGroup& group = m_groups[gi];
+		m_pickVersions[gi] = group.version;
+
+		for (size_t fi = 0; fi + 2 < group.indices.size(); fi += 3) {
+			DWORD i0 = group.indices[fi + 0];
+			DWORD i1 = group.indices[fi + 1];
+			DWORD i2 = group.indices[fi + 2];
+			if (i0 >= group.vertices.size() || i1 >= group.vertices.size() || i2 >= group.vertices.size()) {
+				continue;
+			}
+
+			const D3DVECTOR& v0 = group.vertices[i0].position;
+			const D3DVECTOR& v1 = group.vertices[i1].position;
+			const D3DVECTOR& v2 = group.vertices[i2].position;
+			m_pickTriangles.push_back(v0);
+			m_pickTriangles.push_back(v1);
+			m_pickTriangles.push_back(v2);
+			bounds.push_back(
+				{{std::min({v0.x, v1.x, v2.x}), std::min({v0.y, v1.y, v2.y}), std::min({v0.z, v1.z, v2.z})},
+				 {std::max({v0.x, v1.x, v2.x}), std::max({v0.y, v1.y, v2.y}), std::max({v0.z, v1.z, v2.z})}}
+			);
+		}
+	}
+
+	m_pickBVH.Build(bounds);
+}
+
+bool Direct3DRMMeshImpl::IntersectRay(const Ray& ray, float& outDistance)
+{
+	UpdatePickBVH();
+
+	bool hit = false;
+	m_pickBVH.Traverse(ray, outDistance, [&](Uint32 triangle, float& maxDistance) {
+		const D3DVECTOR* v = &m_pickTriangles[triangle * 3];
+		float dist;
+		if (RayIntersectsTriangle(ray, v[0], v[1], v[2], dist) && dist < maxDistance) {
+			maxDistance = dist;
+			hit = true;
+		}
+	});
+	return hit;
+}
@@ -9,9 +9,9 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_stdinc.h>
+#include <algorithm>
 #include <cassert>
 #include <float.h>
-#include <functional>
 #include <math.h>
 
 Direct3DRMViewportImpl::Direct3DRMViewportImpl(DWORD width, DWORD height, Direct3DRMRenderer* renderer)
@@ -27,18 +27,6 @@ Direct3DRMViewportImpl::~Direct3DRMViewportImpl()
 	}
 }
 
-static void D3DRMMatrixMultiply(D3DRMMATRIX4D out, const D3DRMMATRIX4D a, const D3DRMMATRIX4D b)
-{
-	for (int i = 0; i < 4; ++i) {
-		for (int j = 0; j < 4; ++j) {
-			out[i][j] = 0.0f;
-			for (int k = 0; k < 4; ++k) {
-				out[i][j] += a[i][k] * b[k][j];
-			}
-		}
-	}
-}
-
 static void D3DRMMatrixInvertForNormal(Matrix3x3 out, const D3DRMMATRIX4D m)
 {
 	float a = m[0][0], b = m[0][1], c = m[0][2];
@@ -85,6 +73,27 @@ static void D3DRMMatrixInvertOrthogonal(D3DRMMATRIX4D out, const D3DRMMATRIX4D m
 	out[3][2] = -(out[0][2] * t.x + out[1][2] * t.y + out[2][2] * t.z);
 }
 
+static void D3DRMMatrixInvertAffine(D3DRMMATRIX4D out, const D3DRMMATRIX4D m)
+{
+	Matrix3x3 inverseTranspose;
+	D3DRMMatrixInvertForNormal(inverseTranspose, m);
+
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			out[i][j] = inverseTranspose[j][i];
+		}
+	}
+
+	out[0][3] = out[1][3] = out[2][3] = 0.f;
+	out[3][3] = 1.f;
+
+	D3DVECTOR t = {m[3][0], m[3][1], m[3][2]};
+
+	out[3][0] = -(out[0][0] * t.x + out[1][0] * t.y + out[2][0] * t.z);
+	out[3][1] = -(out[0][1] * t.x + out[1][1] * t.y + out[2][1] * t.z);
+	out[3][2] = -(out[0][2] * t.x + out[1][2] * t.y + out[2][2] * t.z);
+}
+
 static void ComputeFrameWorldMatrix(IDirect3DRMFrame* frame, D3DRMMATRIX4D out)
 {
 	D3DRMMATRIX4D acc = {{1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
@@ -93,7 +102,7 @@ static void ComputeFrameWorldMatrix(IDirect3DRMFrame* frame, D3DRMMATRIX4D out)
 	while (cur) {
 		auto* impl = static_cast<Direct3DRMFrameImpl*>(cur);
 		D3DRMMATRIX4D tmp;
-		D3DRMMatrixMultiply(tmp, impl->m_transform, acc);
+		MultiplyMatrix(tmp, impl->m_transform, acc);
 		memcpy(acc, tmp, sizeof(acc));
 
 		if (cur == impl->m_parent) {
@@ -112,7 +121,7 @@ void Direct3DRMViewportImpl::CollectLightsFromFrame(
 {
 	auto* frameImpl = static_cast<Direct3DRMFrameImpl*>(frame);
 	D3DRMMATRIX4D worldMatrix;
-	D3DRMMatrixMultiply(worldMatrix, parentToWorld, frameImpl->m_transform);
+	MultiplyMatrix(worldMatrix, parentToWorld, frameImpl->m_transform);
 
 	IDirect3DRMLightArray* lightArray = nullptr;
 	frame->GetLights(&lightArray);
@@ -235,7 +244,7 @@ void Direct3DRMViewportImpl::CollectMeshesFromFrame(IDirect3DRMFrame* frame, D3D
 	memcpy(localMatrix, frameImpl->m_transform, sizeof(D3DRMMATRIX4D));
 
 	D3DRMMATRIX4D worldMatrix;
-	D3DRMMatrixMultiply(worldMatrix, parentMatrix, localMatrix);
+	MultiplyMatrix(worldMatrix, parentMatrix, localMatrix);
 
 	Matrix3x3 worldMatrixInvert;
 	D3DRMMatrixInvertForNormal(worldMatrixInvert, worldMatrix);
@@ -286,7 +295,7 @@ void Direct3DRMViewportImpl::CollectMeshesFromFrame(IDirect3DRMFrame* frame, D3D
 						memcpy(m_deferredDraws.back().worldMatrix, worldMatrix, sizeof(D3DRMMATRIX4D));
 						memcpy(m_deferredDraws.back().normalMatrix, worldMatrixInvert, sizeof(Matrix3x3));
 					}
-					else {
+					else if (!m_batchOpaqueDraws) {
 						m_renderer->SubmitDraw(
 							m_renderer->GetMeshId(mesh, &meshGroup),
 							modelViewMatrix,
@@ -296,6 +305,16 @@ void Direct3DRMViewportImpl::CollectMeshesFromFrame(IDirect3DRMFrame* frame, D3D
 							appearance
 						);
 					}
+					else {
+						m_batchedDraws.push_back(
+							{m_renderer->GetMeshId(mesh, &meshGroup), appearance, (Uint32) m_batchInstances.size()}
+						);
+						m_batchInstances.emplace_back();
+						DrawInstance& instance = m_batchInstances.back();
+						memcpy(instance.modelViewMatrix, modelViewMatrix, sizeof(D3DRMMATRIX4D));
+						memcpy(instance.worldMatrix, worldMatrix, sizeof(D3DRMMATRIX4D));
+						memcpy(instance.normalMatrix, worldMatrixInvert, sizeof(Matrix3x3));
+					}
 				}
 			}
 			mesh->Release();
@@ -305,6 +324,88 @@ void Direct3DRMViewportImpl::CollectMeshesFromFrame(IDirect3DRMFrame* frame, D3D
 	visuals->Release();
 }
 
+static bool SameAppearance(const Appearance& a, const Appearance& b)
+{
+	return a.color.r == b.color.r && a.color.g == b.color.g && a.color.b == b.color.b && a.color.a == b.color.a &&
+		   a.shininess == b.shininess && a.textureId == b.textureId && a.flat == b.flat;
+}
+
+static bool AppearanceLess(const Appearance& a, const Appearance& b)
+{
+	Uint32 colorA = ((Uint32) a.color.r << 24) | (a.color.g << 16) | (a.color.b << 8) | a.color.a;
+	Uint32 colorB = ((Uint32) b.color.r << 24) | (b.color.g << 16) | (b.color.b << 8) | b.color.a;
+	if (a.textureId != b.textureId) {
+		return a.textureId < b.textureId;
+	}
+	if (colorA != colorB) {
+		return colorA < colorB;
+	}
+	if (a.shininess != b.shininess) {
+		return a.shininess < b.shininess;
+	}
+	return a.flat < b.flat;
+}
+
+// Meshes shared between frames (e.g. the LODs of identical plants and buildings) share a mesh id,
+// so grouping the opaque draws by mesh id and appearance turns them into one instanced submission each.
+// Only used by renderers that implement instancing; the others draw in scene order while traversing.
+void Direct3DRMViewportImpl::SubmitBatchedDraws()
+{
+	std::sort(
+		m_batchedDraws.begin(),
+		m_batchedDraws.end(),
+		[](const BatchedDrawCommand& a, const BatchedDrawCommand& b) {
+			if (a.meshId != b.meshId) {
+				return a.meshId < b.meshId;
+			}
+			if (!SameAppearance(a.appearance, b.appearance)) {
+				return AppearanceLess(a.appearance, b.appearance);
+			}
+			return a.instance < b.instance;
+		}
+	);
+
+	m_sortedInstances.resize(m_batchedDraws.size());
+	for (size_t i = 0; i < m_batchedDraws.size(); ++i) {
+		m_sortedInstances[i] = m_batchInstances[m_batchedDraws[i].instance];
+	}
+
+	size_t begin = 0;
+	while (begin < m_batchedDraws.size()) {
+		const BatchedDrawCommand& cmd = m_batchedDraws[begin];
+		size_t end = begin + 1;
+		while (end < m_batchedDraws.size() && m_batchedDraws[end].meshId == cmd.meshId &&
+			   SameAppearance(m_batchedDraws[end].appearance, cmd.appearance)) {
+			++end;
+		}
+
+		if (end - begin == 1) {
+			const DrawInstance& instance = m_sortedInstances[begin];
+			m_renderer->SubmitDraw(
+				cmd.meshId,
+				instance.modelViewMatrix,
+				instance.worldMatrix,
+				m_viewMatrix,
+				instance.normalMatrix,
+				cmd.appearance
+			);
+		}
+		else {
+			m_renderer->SubmitDrawInstanced(
+				cmd.meshId,
+				&m_sortedInstances[begin],
+				end - begin,
+				m_viewMatrix,
+				cmd.appearance
+			);
+		}
+		begin = end;
+	}
+
+	m_batchedDraws.clear();
+	m_batchInstances.clear();
+}
+
 HRESULT Direct3DRMViewportImpl::RenderScene()
 {
 	m_backgroundColor = static_cast<Direct3DRMFrameImpl*>(m_rootFrame)->m_backgroundColor;
@@ -313,7 +414,7 @@ HRESULT Direct3DRMViewportImpl::RenderScene()
 	D3DRMMATRIX4D cameraWorld;
 	ComputeFrameWorldMatrix(m_camera, cameraWorld);
 	D3DRMMatrixInvertOrthogonal(m_viewMatrix, cameraWorld);
-	D3DRMMatrixMultiply(m_viewProjectionwMatrix, m_viewMatrix, m_projectionMatrix);
+	MultiplyMatrix(m_viewProjectionwMatrix, m_viewMatrix, m_projectionMatrix);
 
 	D3DRMMATRIX4D identity = {{1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
 
@@ -328,7 +429,9 @@ HRESULT Direct3DRMViewportImpl::RenderScene()
 	BuildViewFrustumPlanes();
 	m_renderer->SetFrustumPlanes(m_frustumPlanes);
 
+	m_batchOpaqueDraws = m_renderer->SupportsInstancing();
 	CollectMeshesFromFrame(m_rootFrame, identity);
+	SubmitBatchedDraws();
 
 	std::sort(
 		m_deferredDraws.begin(),
@@ -556,54 +659,6 @@ HRESULT Direct3DRMViewportImpl::InverseTransform(D3DVECTOR* world, D3DRMVECTOR4D
 	return DD_OK;
 }
 
-struct Ray {
-	D3DVECTOR origin;
-	D3DVECTOR direction;
-};
-
-// Ray-box intersection: slab method
-bool RayIntersectsBox(const Ray& ray, const D3DRMBOX& box, float& outT)
-{
-	float tmin = -FLT_MAX;
-	float tmax = FLT_MAX;
-
-	for (int i = 0; i < 3; ++i) {
-		float origin = (&ray.origin.x)[i];
-		float dir = (&ray.direction.x)[i];
-		float minB = (&box.min.x)[i];
-		float maxB = (&box.max.x)[i];
-
-		if (fabs(dir) < 1e-6f) {
-			if (origin < minB || origin > maxB) {
-				return false;
-			}
-		}
-		else {
-			float invD = 1.0f / dir;
-			float t1 = (minB - origin) * invD;
-			float t2 = (maxB - origin) * invD;
-			if (t1 > t2) {
-				std::swap(t1, t2);
-			}
-			if (t1 > tmin) {
-				tmin = t1;
-			}
-			if (t2 < tmax) {
-				tmax = t2;
-			}
-			if (tmin > tmax) {
-				return false;
-			}
-			if (tmax < 0) {
-				return false;
-			}
-		}
-	}
-
-	outT = tmin >= 0 ? tmin : tmax; // closest positive hit
-	return true;
-}
-
 // Convert screen (x,y) in viewport to picking ray in world space
 Ray BuildPickingRay(
 	float x,
@@ -648,81 +703,6 @@ Ray BuildPickingRay(
 	return Ray{rayOriginWorld, rayDirWorld};
 }
 
-bool RayIntersectsTriangle(
-	const Ray& ray,
-	const D3DVECTOR& v0,
-	const D3DVECTOR& v1,
-	const D3DVECTOR& v2,
-	float& outDist
-)
-{
-	const float EPSILON = 1e-6f;
-	D3DVECTOR edge1 = {v1.x - v0.x, v1.y - v0.y, v1.z - v0.z};
-	D3DVECTOR edge2 = {v2.x - v0.x, v2.y - v0.y, v2.z - v0.z};
-
-	D3DVECTOR h = CrossProduct(ray.direction, edge2);
-	float a = DotProduct(edge1, h);
-	if (fabs(a) < EPSILON) {
-		return false;
-	}
-
-	float f = 1.0f / a;
-	D3DVECTOR s = {ray.origin.x - v0.x, ray.origin.y - v0.y, ray.origin.z - v0.z};
-	float u = f * DotProduct(s, h);
-	if (u < 0.0f || u > 1.0f) {
-		return false;
-	}
-
-	D3DVECTOR q = CrossProduct(s, edge1);
-	float v = f * DotProduct(ray.direction, q);
-	if (v < 0.0f || u + v > 1.0f) {
-		return false;
-	}
-
-	float t = f * DotProduct(edge2, q);
-	if (t > EPSILON) {
-		outDist = t;
-		return true;
-	}
-	return false;
-}
-
-bool RayIntersectsMeshTriangles(
-	const Ray& ray,
-	Direct3DRMMeshImpl& mesh,
-	const D3DRMMATRIX4D& worldMatrix,
-	float& outDistance
-)
-{
-	DWORD groupCount = mesh.GetGroupCount();
-	for (DWORD gi = 0; gi < groupCount; ++gi) {
-		const MeshGroup& meshGroup = mesh.GetGroup(gi);
-
-		// Iterate over each face and do ray-triangle tests
-		for (DWORD fi = 0; fi < meshGroup.indices.size(); fi += 3) {
-			DWORD i0 = meshGroup.indices[fi + 0];
-			DWORD i1 = meshGroup.indices[fi + 1];
-			DWORD i2 = meshGroup.indices[fi + 2];
-
-			// Transform vertices to world space
-			D3DVECTOR tri[3];
-			for (int j = 0; j < 3; ++j) {
-				const D3DVECTOR& v = meshGroup.vertices[(j == 0 ? i0 : (j == 1 ? i1 : i2))].position;
-				tri[j] = TransformPoint(v, worldMatrix);
-			}
-
-			float dist;
-			if (RayIntersectsTriangle(ray, tri[0], tri[1], tri[2], dist)) {
-				if (dist < outDistance) {
-					outDistance = dist;
-				}
-				return true;
-			}
-		}
-	}
-	return false;
-}
-
 inline D3DVECTOR TransformVector(const D3DRMMATRIX4D& mat, const D3DVECTOR& vec)
 {
 	return {
@@ -760,14 +740,127 @@ D3DRMBOX ComputeTransformedAABB(const D3DRMBOX& box, const D3DRMMATRIX4D& mat)
 	return worldBox;
 }
 
+void Direct3DRMViewportImpl::CollectPickMeshes(
+	IDirect3DRMFrame* frame,
+	D3DRMMATRIX4D parentMatrix,
+	int parentNode,
+	std::vector<D3DRMBOX>& bounds
+)
+{
+	Direct3DRMFrameImpl* frameImpl = static_cast<Direct3DRMFrameImpl*>(frame);
+	D3DRMMATRIX4D worldMatrix;
+	MultiplyMatrix(worldMatrix, parentMatrix, frameImpl->m_transform);
+
+	int node = (int) m_pickPath.size();
+	m_pickPath.push_back({frame, parentNode, frameImpl->m_transformVersion, false});
+	memcpy(m_pickPath[node].worldMatrix, worldMatrix, sizeof(D3DRMMATRIX4D));
+
+	IDirect3DRMVisualArray* visuals = nullptr;
+	frame->GetVisuals(&visuals);
+	DWORD count = visuals->GetSize();
+	for (DWORD i = 0; i < count; ++i) {
+		IDirect3DRMVisual* visual = nullptr;
+		visuals->GetElement(i, &visual);
+
+		IDirect3DRMFrame* subFrame = nullptr;
+		visual->QueryInterface(IID_IDirect3DRMFrame, (void**) &subFrame);
+		if (subFrame) {
+			CollectPickMeshes(subFrame, worldMatrix, node, bounds);
+			subFrame->Release();
+			visual->Release();
+			continue;
+		}
+
+		Direct3DRMMeshImpl* mesh = nullptr;
+		visual->QueryInterface(IID_IDirect3DRMMesh, (void**) &mesh);
+		if (mesh) {
+			D3DRMBOX box;
+			mesh->GetBox(&box);
+
+			// Meshes without vertices keep an inverted box
+			if (box.min.x <= box.max.x) {
+				PickMesh entry = {visual, mesh, box, {}, node};
+				D3DRMMatrixInvertAffine(entry.worldToMesh, worldMatrix);
+				m_pickMeshes.push_back(entry);
+				bounds.push_back(ComputeTransformedAABB(box, worldMatrix));
+			}
+			mesh->Release();
+		}
+		visual->Release();
+	}
+	visuals->Release();
+}
+
+// The scene hierarchy only references objects the frame tree holds on to, and any change to the tree bumps
+// g_sceneVersion, so the cached pointers stay valid as long as the version matches.
+void Direct3DRMViewportImpl::UpdatePickScene()
+{
+	if (m_pickRoot == m_rootFrame && m_pickSceneVersion == g_sceneVersion) {
+		RefitPickScene();
+		return;
+	}
+
+	m_pickPath.clear();
+	m_pickMeshes.clear();
+	m_pickBounds.clear();
+
+	D3DRMMATRIX4D identity = {{1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+	CollectPickMeshes(m_rootFrame, identity, -1, m_pickBounds);
+	m_pickBVH.Build(m_pickBounds);
+
+	m_pickRoot = m_rootFrame;
+	m_pickSceneVersion = g_sceneVersion;
+}
+
+// Moving frames keeps the hierarchy intact, so only the world transforms below them and the bounds of the
+// affected meshes are recomputed, and the existing tree is refitted around them
+void Direct3DRMViewportImpl::RefitPickScene()
+{
+	bool moved = false;
+	for (PickPathNode& node : m_pickPath) {
+		Direct3DRMFrameImpl* frameImpl = static_cast<Direct3DRMFrameImpl*>(node.frame);
+		bool parentMoved = node.parent >= 0 && m_pickPath[node.parent].moved;
+		node.moved = parentMoved || node.transformVersion != frameImpl->m_transformVersion;
+		if (!node.moved) {
+			continue;
+		}
+
+		node.transformVersion = frameImpl->m_transformVersion;
+		if (node.parent >= 0) {
+			MultiplyMatrix(node.worldMatrix, m_pickPath[node.parent].worldMatrix, frameImpl->m_transform);
+		}
+		else {
+			memcpy(node.worldMatrix, frameImpl->m_transform, sizeof(D3DRMMATRIX4D));
+		}
+		moved = true;
+	}
+
+	if (!moved) {
+		return;
+	}
+
+	bool meshMoved = false;
+	for (size_t i = 0; i < m_pickMeshes.size(); ++i) {
+		PickMesh& entry = m_pickMeshes[i];
+		const PickPathNode& node = m_pickPath[entry.pathNode];
+		if (node.moved) {
+			D3DRMMatrixInvertAffine(entry.worldToMesh, node.worldMatrix);
+			m_pickBounds[i] = ComputeTransformedAABB(entry.meshBox, node.worldMatrix);
+			meshMoved = true;
+		}
+	}
+
+	if (meshMoved) {
+		m_pickBVH.Refit(m_pickBounds);
+	}
+}
+
 HRESULT Direct3DRMViewportImpl::Pick(float x, float y, LPDIRECT3DRMPICKEDARRAY* pickedArray)
 {
 	if (!m_rootFrame) {
 		return DDERR_GENERIC;
 	}
 
-	std::vector<PickRecord> hits;
-
 	Ray pickRay = BuildPickingRay(
 		x,
 		y,
@@ -780,62 +873,44 @@ HRESULT Direct3DRMViewportImpl::Pick(float x, float y, LPDIRECT3DRMPICKEDARRAY*
 		(float) m_virtualWidth / (float) m_virtualHeight
 	);
 
-	std::function<void(IDirect3DRMFrame*, std::vector<IDirect3DRMFrame*>&)> recurse;
-	recurse = [&](IDirect3DRMFrame* frame, std::vector<IDirect3DRMFrame*>& path) {
-		path.push_back(frame);
-
-		IDirect3DRMVisualArray* visuals = nullptr;
-		frame->GetVisuals(&visuals);
-		DWORD count = visuals->GetSize();
-		for (DWORD i = 0; i < count; ++i) {
-			IDirect3DRMVisual* visual = nullptr;
-			visuals->GetElement(i, &visual);
-
-			IDirect3DRMFrame* subFrame = nullptr;
-			visual->QueryInterface(IID_IDirect3DRMFrame, (void**) &subFrame);
-			if (subFrame) {
-				recurse(subFrame, path);
-				subFrame->Release();
-				visual->Release();
-				continue;
-			}
+	UpdatePickScene();
 
-			Direct3DRMMeshImpl* mesh = nullptr;
-			visual->QueryInterface(IID_IDirect3DRMMesh, (void**) &mesh);
-			if (mesh) {
-				D3DRMBOX box;
-				mesh->GetBox(&box);
-				// Transform box corners to world space
-				D3DRMMATRIX4D worldMatrix;
-				ComputeFrameWorldMatrix(frame, worldMatrix);
-				D3DRMBOX worldBox = ComputeTransformedAABB(box, worldMatrix);
-
-				float boxDist = FLT_MAX;
-
-				// Check box first as an optimization
-				if (RayIntersectsBox(pickRay, worldBox, boxDist)) {
-					float meshDist = FLT_MAX;
-
-					if (RayIntersectsMeshTriangles(pickRay, *mesh, worldMatrix, meshDist)) {
-						auto* arr = new Direct3DRMFrameArrayImpl();
-						for (IDirect3DRMFrame* f : path) {
-							arr->AddElement(f);
-						}
-
-						PickRecord rec = {visual, arr, {meshDist}};
-						hits.push_back(rec);
-					}
-				}
-				mesh->Release();
-			}
-			visual->Release();
+	std::vector<PickRecord> hits;
+	std::vector<IDirect3DRMFrame*> framePath;
+
+	// Every mesh along the ray is reported, so the scene traversal never shrinks its range
+	float maxDistance = FLT_MAX;
+	m_pickBVH.Traverse(pickRay, maxDistance, [&](Uint32 index, float&) {
+		const PickMesh& entry = m_pickMeshes[index];
+		const D3DRMMATRIX4D& m = entry.worldToMesh;
+		const D3DVECTOR& d = pickRay.direction;
+
+		// Mesh space ray. The direction is left unnormalized so hit distances stay in world units.
+		Ray meshRay = {
+			TransformPoint(pickRay.origin, m),
+			{d.x * m[0][0] + d.y * m[1][0] + d.z * m[2][0],
+			 d.x * m[0][1] + d.y * m[1][1] + d.z * m[2][1],
+			 d.x * m[0][2] + d.y * m[1][2] + d.z * m[2][2]}
+		};
+
+		float meshDist = FLT_MAX;
+		if (!entry.mesh->IntersectRay(meshRay, meshDist)) {
+			return;
 		}
-		visuals->Release();
-		path.pop_back(); // Pop after recursion
-	};
 
-	std::vector<IDirect3DRMFrame*> framePath;
-	recurse(m_rootFrame, framePath);
+		framePath.clear();
+		for (int node = entry.pathNode; node >= 0; node = m_pickPath[node].parent) {
+			framePath.push_back(m_pickPath[node].frame);
+		}
+
+		auto* arr = new Direct3DRMFrameArrayImpl();
+		for (auto it = framePath.rbegin(); it != framePath.rend(); ++it) {
+			arr->AddElement(*it);
+		}
+
+		PickRecord rec = {entry.visual, arr, {meshDist}};
+		hits.push_back(rec);
+	});
 
 	std::sort(hits.begin(), hits.end(), [](const PickRecord& a, const PickRecord& b) {
 		return a.desc.dist < b.desc.dist;
@@ -0,0 +1,111 @@
+#include "bvh.h"
+
+#include <algorithm>
+
+static constexpr Uint32 MAX_LEAF_SIZE = 4; // Primitives per leaf
+
+Uint32 g_sceneVersion = 0;
+
+static void ExpandBox(D3DRMBOX& box, const D3DVECTOR& min, const D3DVECTOR& max)
+{
+	box.min = {std::min(box.min.x, min.x), std::min(box.min.y, min.y), std::min(box.min.z, min.z)};
+	box.max = {std::max(box.max.x, max.x), std::max(box.max.y, max.y), std::max(box.max.z, max.z)};
+}
+
+void BVH::Build(const std::vector<D3DRMBOX>& bounds)
+{
+	Clear();
+
+	Uint32 count = (Uint32) bounds.size();
+	if (!count) {
+		return;
+	}
+
+	std::vector<D3DVECTOR> centers(count);
+	m_indices.resize(count);
+	for (Uint32 i = 0; i < count; ++i) {
+		const D3DRMBOX& box = bounds[i];
+		centers[i] = {
+			(box.min.x + box.max.x) * 0.5f,
+			(box.min.y + box.max.y) * 0.5f,
+			(box.min.z + box.max.z) * 0.5f
+		};
+		m_indices[i] = i;
+	}
+
+	m_nodes.reserve(2 * (count / MAX_LEAF_SIZE + 1));
+	BuildNode(bounds, centers, 0, count);
+}
+
+void BVH::Refit(const std::vector<D3DRMBOX>& bounds)
+{
+	// Children always come after their parent, so walking backwards updates them first
+	for (Uint32 i = (Uint32) m_nodes.size(); i-- > 0;) {
+		BVHNode& node = m_nodes[i];
+		if (node.count) {
+			node.box = bounds[m_indices[node.offset]];
+			for (Uint32 j = 1; j < node.count; ++j) {
+				const D3DRMBOX& b = bounds[m_indices[node.offset + j]];
+				ExpandBox(node.box, b.min, b.max);
+			}
+		}
+		else {
+			node.box = m_nodes[i + 1].box;
+			ExpandBox(node.box, m_nodes[node.offset].box.min, m_nodes[node.offset].box.max);
+		}
+	}
+}
+
+void BVH::Clear()
+{
+	m_nodes.clear();
+	m_indices.clear();
+}
+
+Uint32 BVH::BuildNode(
+	const std::vector<D3DRMBOX>& bounds,
+	const std::vector<D3DVECTOR>& centers,
+	Uint32 begin,
+	Uint32 end
+)
+{
+	D3DRMBOX box = bounds[m_indices[begin]];
+	D3DRMBOX centerBox = {centers[m_indices[begin]], centers[m_indices[begin]]};
+
+	for (Uint32 i = begin + 1; i < end; ++i) {
+		const D3DRMBOX& b = bounds[m_indices[i]];
+		const D3DVECTOR& c = centers[m_indices[i]];
+		ExpandBox(box, b.min, b.max);
+		ExpandBox(centerBox, c, c);
+	}
+
+	Uint32 index = (Uint32) m_nodes.size();
+	m_nodes.push_back({box, begin, end - begin});
+
+	if (end - begin <= MAX_LEAF_SIZE) {
+		return index;
+	}
+
+	// Median split along the widest axis of the primitive centers
+	D3DVECTOR extent = {
+		centerBox.max.x - centerBox.min.x,
+		centerBox.max.y - centerBox.min.y,
+		centerBox.max.z - centerBox.min.z
+	};
+	int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+
+	Uint32 mid = begin + (end - begin) / 2;
+	std::nth_element(
+		m_indices.begin() + begin,
+		m_indices.begin() + mid,
+		m_indices.begin() + end,
+		[&centers, axis](Uint32 a, Uint32 b) { return (&centers[a].x)[axis] < (&centers[b].x)[axis]; }
+	);
+
+	BuildNode(bounds, centers, begin, mid);
+	Uint32 second = BuildNode(bounds, centers, mid, end);
+
+	m_nodes[index].offset = second;
+	m_nodes[index].count = 0;
+	return index;
+}
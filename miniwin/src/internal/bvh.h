@@ -0,0 +1,157 @@
+#pragma once
+
+#include "miniwin/d3drm.h"
+
+#include <SDL3/SDL_stdinc.h>
+#include <float.h>
+#include <math.h>
+#include <vector>
+
+struct Ray {
+	D3DVECTOR origin;
+	D3DVECTOR direction;
+};
+
+// Incremented whenever the frame hierarchy, a frame's visuals or mesh geometry changes, so cached scene data
+// (e.g. the viewport's picking hierarchy) can tell whether it is still valid. Frame transforms are versioned
+// per frame instead, see Direct3DRMFrameImpl::m_transformVersion.
+extern Uint32 g_sceneVersion;
+
+struct BVHNode {
+	D3DRMBOX box;
+	Uint32 offset; // Leaves: first entry in the primitive index list. Inner nodes: index of the second child,
+				   // the first child always directly follows its parent.
+	Uint32 count;  // Number of primitives, 0 for inner nodes
+};
+
+// Axis-aligned bounding volume hierarchy over a set of primitive bounds. Primitives are referred to by their
+// index in the bounds list passed to Build().
+class BVH {
+public:
+	void Build(const std::vector<D3DRMBOX>& bounds);
+	// Recomputes the node boxes for updated primitive bounds without changing the tree's structure
+	void Refit(const std::vector<D3DRMBOX>& bounds);
+	void Clear();
+	bool IsEmpty() const { return m_nodes.empty(); }
+
+	// Calls visit(primitive, maxDistance) for every primitive whose leaf box the ray enters before maxDistance.
+	// Children are visited front to back, so a closest-hit query can shrink maxDistance to prune the rest.
+	template <typename Fn>
+	void Traverse(const Ray& ray, float& maxDistance, Fn&& visit) const
+	{
+		if (m_nodes.empty()) {
+			return;
+		}
+
+		D3DVECTOR invDir = {
+			fabsf(ray.direction.x) > 1e-6f ? 1.0f / ray.direction.x : 0.0f,
+			fabsf(ray.direction.y) > 1e-6f ? 1.0f / ray.direction.y : 0.0f,
+			fabsf(ray.direction.z) > 1e-6f ? 1.0f / ray.direction.z : 0.0f
+		};
+
+		struct StackEntry {
+			Uint32 node;
+			float entry;
+		};
+		StackEntry stack[64];
+		int top = 0;
+
+		float entry;
+		if (IntersectBox(m_nodes[0].box, ray, invDir, maxDistance, entry)) {
+			stack[top++] = {0, entry};
+		}
+
+		while (top > 0) {
+			StackEntry current = stack[--top];
+			if (current.entry > maxDistance) {
+				continue;
+			}
+
+			const BVHNode& node = m_nodes[current.node];
+			if (node.count) {
+				for (Uint32 i = 0; i < node.count; ++i) {
+					visit(m_indices[node.offset + i], maxDistance);
+				}
+				continue;
+			}
+
+			Uint32 first = current.node + 1;
+			Uint32 second = node.offset;
+			float firstEntry, secondEntry;
+			bool hitFirst = IntersectBox(m_nodes[first].box, ray, invDir, maxDistance, firstEntry);
+			bool hitSecond = IntersectBox(m_nodes[second].box, ray, invDir, maxDistance, secondEntry);
+
+			// Push the farther child first so the nearer one is visited next
+			if (hitFirst && hitSecond) {
+				if (firstEntry < secondEntry) {
+					stack[top++] = {second, secondEntry};
+					stack[top++] = {first, firstEntry};
+				}
+				else {
+					stack[top++] = {first, firstEntry};
+					stack[top++] = {second, secondEntry};
+				}
+			}
+			else if (hitFirst) {
+				stack[top++] = {first, firstEntry};
+			}
+			else if (hitSecond) {
+				stack[top++] = {second, secondEntry};
+			}
+		}
+	}
+
+private:
+	Uint32 BuildNode(
+		const std::vector<D3DRMBOX>& bounds,
+		const std::vector<D3DVECTOR>& centers,
+		Uint32 begin,
+		Uint32 end
+	);
+
+	// Slab test; axes the ray runs parallel to (invDir 0) only check that the origin lies within the slab
+	static bool IntersectBox(
+		const D3DRMBOX& box,
+		const Ray& ray,
+		const D3DVECTOR& invDir,
+		float maxDistance,
+		float& outEntry
+	)
+	{
+		float tmin = 0.0f;
+		float tmax = maxDistance;
+
+		for (int i = 0; i < 3; ++i) {
+			float origin = (&ray.origin.x)[i];
+			float inv = (&invDir.x)[i];
+			float minB = (&box.min.x)[i];
+			float maxB = (&box.max.x)[i];
+
+			if (inv == 0.0f) {
+				if (origin < minB || origin > maxB) {
+					return false;
+				}
+				continue;
+			}
+
+			float t1 = (minB - origin) * inv;
+			float t2 = (maxB - origin) * inv;
+			if (t1 > t2) {
+				float t = t1;
+				t1 = t2;
+				t2 = t;
+			}
+			tmin = t1 > tmin ? t1 : tmin;
+			tmax = t2 < tmax ? t2 : tmax;
+			if (tmin > tmax) {
+				return false;
+			}
+		}
+
+		outEntry = tmin;
+		return true;
+	}
+
+	std::vector<BVHNode> m_nodes;
+	std::vector<Uint32> m_indices;
+};
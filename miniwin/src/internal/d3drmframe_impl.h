@@ -32,6 +32,9 @@ struct Direct3DRMFrameImpl : public Direct3DRMObjectBaseImpl<IDirect3DRMFrame2>
 	Direct3DRMFrameImpl* m_parent{};
 	D3DRMMATRIX4D m_transform =
 		{{1.f, 0.f, 0.f, 0.f}, {0.f, 1.f, 0.f, 0.f}, {0.f, 0.f, 1.f, 0.f}, {0.f, 0.f, 0.f, 1.f}};
+	// Incremented by AddTransform. Moving a frame leaves g_sceneVersion alone, so cached scene data only has to
+	// update what hangs below the frames whose version changed.
+	Uint32 m_transformVersion = 0;
 
 private:
 	Direct3DRMFrameArrayImpl* m_children{};
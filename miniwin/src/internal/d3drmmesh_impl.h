@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bvh.h"
 #include "d3drmobject_impl.h"
 
 #include <algorithm>
@@ -99,9 +100,18 @@ struct Direct3DRMMeshImpl : public Direct3DRMObjectBaseImpl<IDirect3DRMMesh> {
 	HRESULT GetVertices(D3DRMGROUPINDEX groupIndex, int startIndex, int count, D3DRMVERTEX* vertices) override;
 	HRESULT GetBox(D3DRMBOX* box) override;
 
+	// Closest hit of a mesh space ray with the mesh triangles, in multiples of the ray direction
+	bool IntersectRay(const Ray& ray, float& outDistance);
+
 private:
 	void UpdateBox();
+	void UpdatePickBVH();
 
 	std::vector<MeshGroup> m_groups;
 	D3DRMBOX m_box;
+
+	// Triangle hierarchy for picking, built on the first pick and rebuilt when a group's version changes
+	BVH m_pickBVH;
+	std::vector<D3DVECTOR> m_pickTriangles; // Three vertices per triangle
+	std::vector<int> m_pickVersions;
 };
@@ -27,6 +27,13 @@ struct Plane {
 	float d;
 };
 
+// Per-instance part of a batched draw. Mesh, appearance and view matrix are shared by the whole batch.
+struct DrawInstance {
+	D3DRMMATRIX4D modelViewMatrix;
+	D3DRMMATRIX4D worldMatrix;
+	Matrix3x3 normalMatrix;
+};
+
 class Direct3DRMRenderer : public IDirect3DDevice2 {
 public:
 	virtual void PushLights(const SceneLight* vertices, size_t count) = 0;
@@ -48,6 +55,29 @@ class Direct3DRMRenderer : public IDirect3DDevice2 {
 		const Matrix3x3& normalMatrix,
 		const Appearance& appearance
 	) = 0;
+	// Draws one mesh group at several transforms. Backends that override this also return true from
+	// SupportsInstancing(), otherwise opaque draws are submitted one by one in scene order.
+	virtual bool SupportsInstancing() const { return false; }
+	virtual void SubmitDrawInstanced(
+		DWORD meshId,
+		const DrawInstance* instances,
+		size_t count,
+		const D3DRMMATRIX4D& viewMatrix,
+		const Appearance& appearance
+	)
+	{
+		for (size_t i = 0; i < count; ++i) {
+			const DrawInstance& instance = instances[i];
+			SubmitDraw(
+				meshId,
+				instance.modelViewMatrix,
+				instance.worldMatrix,
+				viewMatrix,
+				instance.normalMatrix,
+				appearance
+			);
+		}
+	}
 	virtual HRESULT FinalizeFrame() = 0;
 	virtual void Resize(int width, int height, const ViewportTransform& viewportTransform) = 0;
 	virtual void Clear(float r, float g, float b) = 0;
@@ -72,10 +72,12 @@ class OpenGLES2Renderer : public Direct3DRMRenderer {
 	void AddTextureDestroyCallback(Uint32 id, IDirect3DRMTexture* texture);
 	void AddMeshDestroyCallback(Uint32 id, IDirect3DRMMesh* mesh);
 	bool UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI);
+	bool UpdateTexture(SDL_Surface* source, GLuint texId, bool isUI);
 
 	MeshGroup m_uiMesh;
 	GLES2MeshCacheEntry m_uiMeshCache;
 	std::vector<GLES2TextureCacheEntry> m_textures;
+	std::vector<Uint8> m_pixelBuffer;
 	std::vector<GLES2MeshCacheEntry> m_meshs;
 	D3DRMMATRIX4D m_projection;
 	SDL_Surface* m_renderedImage = nullptr;
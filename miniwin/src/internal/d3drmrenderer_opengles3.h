@@ -68,6 +68,14 @@ class OpenGLES3Renderer : public Direct3DRMRenderer {
 		const Matrix3x3& normalMatrix,
 		const Appearance& appearance
 	) override;
+	bool SupportsInstancing() const override { return m_useInstancing; }
+	void SubmitDrawInstanced(
+		DWORD meshId,
+		const DrawInstance* instances,
+		size_t count,
+		const D3DRMMATRIX4D& viewMatrix,
+		const Appearance& appearance
+	) override;
 	HRESULT FinalizeFrame() override;
 	void Resize(int width, int height, const ViewportTransform& viewportTransform) override;
 	void Clear(float r, float g, float b) override;
@@ -81,10 +89,13 @@ class OpenGLES3Renderer : public Direct3DRMRenderer {
 	void AddMeshDestroyCallback(Uint32 id, IDirect3DRMMesh* mesh);
 	GLES3MeshCacheEntry GLES3UploadMesh(const MeshGroup& meshGroup, bool forceUV = false);
 	bool UploadTexture(SDL_Surface* source, GLuint& outTexId, bool isUI);
+	bool UpdateTexture(SDL_Surface* source, GLuint texId, bool isUI);
+	void SetAppearance(const Appearance& appearance);
 
 	MeshGroup m_uiMesh;
 	GLES3MeshCacheEntry m_uiMeshCache;
 	std::vector<GLES3TextureCacheEntry> m_textures;
+	std::vector<Uint8> m_pixelBuffer;
 	std::vector<GLES3MeshCacheEntry> m_meshs;
 	D3DRMMATRIX4D m_projection;
 	SDL_Surface* m_renderedImage = nullptr;
@@ -100,6 +111,8 @@ class OpenGLES3Renderer : public Direct3DRMRenderer {
 	GLuint m_depthTarget = 0;
 	GLuint m_shaderProgram = 0;
 	GLuint m_dummyTexture = 0;
+	GLuint m_instanceVbo = 0;
+	bool m_useInstancing = false;
 	GLint m_posLoc;
 	GLint m_normLoc;
 	GLint m_texLoc;
@@ -112,6 +125,7 @@ class OpenGLES3Renderer : public Direct3DRMRenderer {
 	GLint m_modelViewMatrixLoc;
 	GLint m_normalMatrixLoc;
 	GLint m_projectionMatrixLoc;
+	GLint m_instancedLoc;
 	ViewportTransform m_viewportTransform;
 };
 
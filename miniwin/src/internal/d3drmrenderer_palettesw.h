@@ -112,10 +112,17 @@ class Direct3DRMPaletteSWRenderer : public Direct3DRMRenderer {
 	std::vector<Uint8> m_vertexLit;
 	Plane m_frustumPlanes[6];
 
-	// Memoized nearest-palette lookup for untextured material colors
-	SDL_Color m_cachedMaterialColor = {0, 0, 0, 0};
-	Uint8 m_cachedMaterialIdx = 0;
-	bool m_materialCacheValid = false;
+	// Memoized nearest-palette lookup for untextured material colors.
+	// Direct-mapped on the RGB value; a scene uses a few dozen material
+	// colours, so nearly every lookup after the first frame is a hit.
+	struct MaterialCacheEntry {
+		SDL_Color color;
+		Uint8 index;
+		bool valid;
+	};
+	static constexpr int MATERIAL_CACHE_SIZE = 64;
+	MaterialCacheEntry m_materialCache[MATERIAL_CACHE_SIZE] = {};
+	void InvalidateMaterialCache() { SDL_zeroa(m_materialCache); }
 
 	// Lighting LUT: for each of 256 palette entries x 32 brightness levels,
 	// store the best-matching palette index.
@@ -61,6 +61,14 @@ class Direct3DRMSDL3GPURenderer : public Direct3DRMRenderer {
 		const Matrix3x3& normalMatrix,
 		const Appearance& appearance
 	) override;
+	bool SupportsInstancing() const override { return true; }
+	void SubmitDrawInstanced(
+		DWORD meshId,
+		const DrawInstance* instances,
+		size_t count,
+		const D3DRMMATRIX4D& viewMatrix,
+		const Appearance& appearance
+	) override;
 	HRESULT FinalizeFrame() override;
 	void Resize(int width, int height, const ViewportTransform& viewportTransform) override;
 	void Clear(float r, float g, float b) override;
@@ -99,6 +107,7 @@ class Direct3DRMSDL3GPURenderer : public Direct3DRMRenderer {
 	D3DDEVICEDESC m_desc;
 	D3DRMMATRIX4D m_projection;
 	std::vector<SDL3TextureCache> m_textures;
+	std::vector<Uint8> m_pixelBuffer;
 	std::vector<SDL3MeshCache> m_meshs;
 	SDL_GPUDevice* m_device;
 	SDL_GPUGraphicsPipeline* m_opaquePipeline;
@@ -22,6 +22,19 @@ struct MeshCache {
 	bool flat;
 	std::vector<D3DRMVERTEX> vertices;
 	std::vector<uint16_t> indices;
+
+	// Post-transform cache: view-space positions and lit colors from the last
+	// draw of this mesh, reused while it is drawn with the same transforms,
+	// lights and material (static scenery under an idle camera).
+	bool transformValid = false;
+	D3DRMMATRIX4D modelViewMatrix;
+	Matrix3x3 normalMatrix;
+	Uint32 lightVersion;
+	SDL_Color materialColor;
+	float shininess;
+	std::vector<D3DVECTOR> transformedPositions;
+	std::vector<SDL_Color> vertexColors;
+	std::vector<Uint8> vertexLit;
 };
 
 // Vertex after transform + lighting: rasterizer input.  Carrying the lit
@@ -89,6 +102,7 @@ class Direct3DRMSoftwareRenderer : public Direct3DRMRenderer {
 	SDL_Renderer* m_renderer;
 	const SDL_PixelFormatDetails* m_format;
 	std::vector<PreparedLight> m_preparedLights;
+	std::vector<PreparedLight> m_previousLights; // Last frame's lights, to detect changes
 	float m_ambientR = 0.0f;
 	float m_ambientG = 0.0f;
 	float m_ambientB = 0.0f;
@@ -99,9 +113,7 @@ class Direct3DRMSoftwareRenderer : public Direct3DRMRenderer {
 	Matrix3x3 m_normalMatrix;
 	D3DRMMATRIX4D m_projection;
 	std::vector<float> m_zBuffer;
-	std::vector<D3DVECTOR> m_transformedPositions;
-	std::vector<SDL_Color> m_vertexColors; // per-vertex lighting cache for the current draw
-	std::vector<Uint8> m_vertexLit;
+	Uint32 m_lightVersion = 0; // Bumped whenever PushLights changes the prepared lights
 	Plane m_frustumPlanes[6];
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bvh.h"
 #include "d3drmobject_impl.h"
 #include "d3drmrenderer.h"
 #include "miniwin/d3drm.h"
@@ -16,6 +17,31 @@ struct DeferredDrawCommand {
 	float depth;
 };
 
+// Opaque draw queued during scene traversal; draws of the same mesh group are submitted together
+struct BatchedDrawCommand {
+	DWORD meshId;
+	Appearance appearance;
+	Uint32 instance; // Index into the viewport's batch instance list
+};
+
+struct Direct3DRMMeshImpl;
+
+struct PickMesh {
+	IDirect3DRMVisual* visual;
+	Direct3DRMMeshImpl* mesh;
+	D3DRMBOX meshBox;
+	D3DRMMATRIX4D worldToMesh;
+	int pathNode; // Index of the containing frame in the viewport's pick path list
+};
+
+struct PickPathNode {
+	IDirect3DRMFrame* frame;
+	int parent; // Always precedes the node in the pick path list
+	Uint32 transformVersion;
+	bool moved; // The frame or one of its ancestors moved since the last refit
+	D3DRMMATRIX4D worldMatrix;
+};
+
 class Direct3DRMDeviceImpl;
 class Direct3DRMFrameImpl;
 
@@ -50,9 +76,22 @@ struct Direct3DRMViewportImpl : public Direct3DRMObjectBaseImpl<IDirect3DRMViewp
 	HRESULT RenderScene();
 	void CollectLightsFromFrame(IDirect3DRMFrame* frame, D3DRMMATRIX4D parentMatrix, std::vector<SceneLight>& lights);
 	void CollectMeshesFromFrame(IDirect3DRMFrame* frame, D3DRMMATRIX4D parentMatrix);
+	void SubmitBatchedDraws();
 	void BuildViewFrustumPlanes();
+	void UpdatePickScene();
+	void RefitPickScene();
+	void CollectPickMeshes(
+		IDirect3DRMFrame* frame,
+		D3DRMMATRIX4D parentMatrix,
+		int parentNode,
+		std::vector<D3DRMBOX>& bounds
+	);
 	Direct3DRMRenderer* m_renderer;
 	std::vector<DeferredDrawCommand> m_deferredDraws;
+	std::vector<BatchedDrawCommand> m_batchedDraws;
+	std::vector<DrawInstance> m_batchInstances;
+	std::vector<DrawInstance> m_sortedInstances;
+	bool m_batchOpaqueDraws = false;
 	D3DCOLOR m_backgroundColor = 0xFF000000;
 	DWORD m_virtualWidth;
 	DWORD m_virtualHeight;
@@ -66,6 +105,15 @@ struct Direct3DRMViewportImpl : public Direct3DRMObjectBaseImpl<IDirect3DRMViewp
 	D3DVALUE m_back = 10.f;
 	D3DVALUE m_field = 0.5f;
 	Plane m_frustumPlanes[6];
+
+	// Pickable meshes with their world space bounds, rebuilt when the root frame or g_sceneVersion changes
+	// and refitted when frames along their paths move
+	std::vector<PickPathNode> m_pickPath;
+	std::vector<PickMesh> m_pickMeshes;
+	std::vector<D3DRMBOX> m_pickBounds;
+	BVH m_pickBVH;
+	IDirect3DRMFrame* m_pickRoot = nullptr;
+	Uint32 m_pickSceneVersion = 0;
 };
 
 struct Direct3DRMViewportArrayImpl
@@ -3,6 +3,17 @@
 #include "miniwin/d3drm.h"
 
 #include <math.h>
+#include <string.h>
+
+// Define ISLE_SCALAR_MATH to use the plain loops below instead of SSE/NEON, e.g. to validate results against them.
+// The vector paths do the same multiplies and adds in the same order, so they only differ in the sign of zero.
+#if !defined(ISLE_SCALAR_MATH) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define MINIWIN_SSE
+#elif !defined(ISLE_SCALAR_MATH) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define MINIWIN_NEON
+#endif
 
 typedef D3DVALUE Matrix3x3[3][3];
 
@@ -37,21 +48,72 @@ inline D3DVECTOR CrossProduct(const D3DVECTOR& a, const D3DVECTOR& b)
 
 inline D3DVECTOR TransformPoint(const D3DVECTOR& p, const D3DRMMATRIX4D& m)
 {
+#if defined(MINIWIN_SSE)
+	__m128 r = _mm_mul_ps(_mm_set1_ps(p.x), _mm_loadu_ps(m[0]));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p.y), _mm_loadu_ps(m[1])));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(p.z), _mm_loadu_ps(m[2])));
+	r = _mm_add_ps(r, _mm_loadu_ps(m[3]));
+	float out[4];
+	_mm_storeu_ps(out, r);
+	return {out[0], out[1], out[2]};
+#elif defined(MINIWIN_NEON)
+	float32x4_t r = vmulq_n_f32(vld1q_f32(m[0]), p.x);
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m[1]), p.y));
+	r = vaddq_f32(r, vmulq_n_f32(vld1q_f32(m[2]), p.z));
+	r = vaddq_f32(r, vld1q_f32(m[3]));
+	return {vgetq_lane_f32(r, 0), vgetq_lane_f32(r, 1), vgetq_lane_f32(r, 2)};
+#else
 	return {
 		p.x * m[0][0] + p.y * m[1][0] + p.z * m[2][0] + m[3][0],
 		p.x * m[0][1] + p.y * m[1][1] + p.z * m[2][1] + m[3][1],
 		p.x * m[0][2] + p.y * m[1][2] + p.z * m[2][2] + m[3][2]
 	};
+#endif
 }
 
-inline void MultiplyMatrix(D3DRMMATRIX4D& out, const D3DRMMATRIX4D& a, const D3DRMMATRIX4D& b)
+// out = a * b. out may alias a or b.
+inline void MultiplyMatrix(D3DVALUE (*out)[4], const D3DVALUE (*a)[4], const D3DVALUE (*b)[4])
 {
+#if defined(MINIWIN_SSE)
+	__m128 b0 = _mm_loadu_ps(b[0]);
+	__m128 b1 = _mm_loadu_ps(b[1]);
+	__m128 b2 = _mm_loadu_ps(b[2]);
+	__m128 b3 = _mm_loadu_ps(b[3]);
+	__m128 rows[4];
+	for (int row = 0; row < 4; ++row) {
+		__m128 r = _mm_mul_ps(_mm_set1_ps(a[row][0]), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[row][1]), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[row][2]), b2));
+		rows[row] = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[row][3]), b3));
+	}
+	for (int row = 0; row < 4; ++row) {
+		_mm_storeu_ps(out[row], rows[row]);
+	}
+#elif defined(MINIWIN_NEON)
+	float32x4_t b0 = vld1q_f32(b[0]);
+	float32x4_t b1 = vld1q_f32(b[1]);
+	float32x4_t b2 = vld1q_f32(b[2]);
+	float32x4_t b3 = vld1q_f32(b[3]);
+	float32x4_t rows[4];
+	for (int row = 0; row < 4; ++row) {
+		float32x4_t r = vmulq_n_f32(b0, a[row][0]);
+		r = vaddq_f32(r, vmulq_n_f32(b1, a[row][1]));
+		r = vaddq_f32(r, vmulq_n_f32(b2, a[row][2]));
+		rows[row] = vaddq_f32(r, vmulq_n_f32(b3, a[row][3]));
+	}
+	for (int row = 0; row < 4; ++row) {
+		vst1q_f32(out[row], rows[row]);
+	}
+#else
+	D3DRMMATRIX4D result;
 	for (int row = 0; row < 4; ++row) {
 		for (int col = 0; col < 4; ++col) {
-			out[row][col] = 0.0;
+			result[row][col] = 0.0;
 			for (int k = 0; k < 4; ++k) {
-				out[row][col] += a[row][k] * b[k][col];
+				result[row][col] += a[row][k] * b[k][col];
 			}
 		}
 	}
+	memcpy(out, result, sizeof(D3DRMMATRIX4D));
+#endif
 }
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <SDL3/SDL_surface.h>
+#include <vector>
+
+// Expands an INDEX8 surface into 32-bit pixels of the given format through a 256-entry table built from its
+// palette. Used for textures that change every frame (videos, animated textures) instead of allocating a new
+// surface with SDL_ConvertSurface each time. Like SDL_ConvertSurface, the color key index gets alpha 0.
+// Returns false if the source is not INDEX8 or the format is not 32 bits per pixel.
+bool ExpandIndexedPixels(SDL_Surface* source, SDL_PixelFormat format, void* pixels, int pitch);
+
+// Returns the source pixels as tightly packed RGBA32, converted into buffer unless the surface already is
+const void* GetRGBA32Pixels(SDL_Surface* source, std::vector<Uint8>& buffer);